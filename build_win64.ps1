@@ -59,9 +59,15 @@ $hashSources = @(
     "$cryptoPath\md5\md5.c",
     "$cryptoPath\sha0\sha0.c",
     "$cryptoPath\sha1\sha1.c",
+    "$cryptoPath\sha1\sha1_shani.c",
     "$cryptoPath\sha224\sha224.c",
     "$cryptoPath\sha256\sha256.c",
+    "$cryptoPath\sha256\sha256_shani.c",
+    "$cryptoPath\sha256\sha256_avx2.c",
+    "$cryptoPath\sha256\sha256_avx512.c",
     "$cryptoPath\sha512\sha512.c",
+    "$cryptoPath\sha512\sha512_avx2.c",
+    "$cryptoPath\sha512\sha512_avx512.c",
     "$cryptoPath\sha3\sha3.c",
     "$cryptoPath\sha3_224\sha3_224.c",
     "$cryptoPath\sha3_384\sha3_384.c",
@@ -72,10 +78,21 @@ $hashSources = @(
     "$cryptoPath\ripemd256\ripemd256.c",
     "$cryptoPath\ripemd320\ripemd320.c",
     "$cryptoPath\blake2b\blake2b.c",
+    "$cryptoPath\blake2b\blake2b_avx2.c",
     "$cryptoPath\blake2s\blake2s.c",
+    "$cryptoPath\blake2s\blake2s_ssse3.c",
+    "$cryptoPath\blake2bp\blake2bp.c",
+    "$cryptoPath\blake2sp\blake2sp.c",
     "$cryptoPath\whirlpool\whirlpool.c",
+    "$cryptoPath\whirlpool\whirlpool_gfni.c",
     "$cryptoPath\has160\has160.c",
-    "$cryptoPath\nt\nt.c"
+    "$cryptoPath\nt\nt.c",
+    "$cryptoPath\registry\hash_registry.c",
+    "$cryptoPath\cpu\cpu_features.c",
+    "$cryptoPath\md_lanes\md_lanes.c",
+    "$cryptoPath\keccak1600\keccak1600.c",
+    "$cryptoPath\keccak1600\keccak1600_lanes.c",
+    "$cryptoPath\blake2_lanes\blake2_lanes.c"
 )
 
 # Verify sources exist
@@ -120,9 +137,16 @@ $includePaths = @(
     "$cryptoPath\ripemd320",
     "$cryptoPath\blake2b",
     "$cryptoPath\blake2s",
+    "$cryptoPath\blake2bp",
+    "$cryptoPath\blake2sp",
     "$cryptoPath\whirlpool",
     "$cryptoPath\has160",
-    "$cryptoPath\nt"
+    "$cryptoPath\nt",
+    "$cryptoPath\registry",
+    "$cryptoPath\cpu",
+    "$cryptoPath\md_lanes",
+    "$cryptoPath\keccak1600",
+    "$cryptoPath\blake2_lanes"
 )
 
 $includeFlags = ($includePaths | ForEach-Object { "-I$_" }) -join " "
@@ -133,7 +157,7 @@ Write-Host "  OK Configured $($includePaths.Count) include paths"
 Write-Host "`nStep 4: Building client.dll..."
 
 $clientSources = "$src_dir\client.c " + ($hashSources -join " ")
-$clientCmd = "gcc -shared -static-libgcc -o `"$clientLibPath\client.dll`" $clientSources $includeFlags `"-Wl,--out-implib,$clientCLibPath\client.lib`""
+$clientCmd = "gcc -O2 -shared -static-libgcc -o `"$clientLibPath\client.dll`" $clientSources $includeFlags `"-Wl,--out-implib,$clientCLibPath\client.lib`""
 
 Write-Host "  Compiling..."
 $output = Invoke-Expression $clientCmd 2>&1
@@ -156,7 +180,7 @@ if (Test-Path "$clientLibPath\client.dll") {
 Write-Host "`nStep 5: Building server.dll..."
 
 $serverSources = "$src_dir\server.c " + ($hashSources -join " ")
-$serverCmd = "gcc -shared -static-libgcc -o `"$serverLibPath\server.dll`" $serverSources $includeFlags `"-Wl,--out-implib,$serverCLibPath\server.lib`""
+$serverCmd = "gcc -O2 -shared -static-libgcc -o `"$serverLibPath\server.dll`" $serverSources $includeFlags -lbcrypt `"-Wl,--out-implib,$serverCLibPath\server.lib`""
 
 Write-Host "  Compiling..."
 $output = Invoke-Expression $serverCmd 2>&1
@@ -221,13 +245,14 @@ try {
         Write-Host "`nPython utilities:"
         Write-Host "  - pow_utils_client.py"
         Write-Host "  - pow_utils_server.py"
-        Write-Host "`nSupported algorithms: 34"
+        Write-Host "`nSupported algorithms: 38"
         Write-Host "  MD2, MD4, MD5, NT, HAS-160,"
         Write-Host "  RIPEMD-128/160/256/320,"
         Write-Host "  BLAKE2b-128/160/256/384/512, BLAKE2s-128/160/256,"
+        Write-Host "  BLAKE2bp-512, BLAKE2sp-256,"
         Write-Host "  SHA-0, SHA-1, SHA2-224/256/384/512,"
         Write-Host "  SHA3-224/256/384/512, Keccak-224/256/384/512,"
-        Write-Host "  SHAKE-128/256, Whirlpool"
+        Write-Host "  SHAKE-128/256, Whirlpool, Whirlpool-0, Whirlpool-T"
     } else {
         Write-Host "TESTS FAILED"
         exit 1
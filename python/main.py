@@ -5,9 +5,12 @@ Tests single and multi-hash PoW with all supported algorithms
 """
 import sys
 import os
+import time
+import hashlib
 from pathlib import Path
-from utils_client import PoWClient, create_multi_pow_challenge
-from utils_server import PoWServer
+from utils_client import PoWClient, create_multi_pow_challenge, OPTIMIZED_ORDER, CURSOR_FOUND, CURSOR_PAUSED, NONCE_MAX
+from utils_server import (PoWServer, VERIFY_OK, VERIFY_INVALID, VERIFY_REPLAY,
+                          VERIFY_BAD_CHALLENGE, VERIFY_EXPIRED)
 
 # Test parameters
 TEST_TEXT = b"hello world"
@@ -165,6 +168,24 @@ if result['success']:
 else:
     print(f"FAILED: No nonce found within {MAX_NONCE} attempts")
 
+# Multi-hash test 4: more algorithms than a result has digests for, slowest
+# listed first; the library picks its own evaluation order
+print("\n" + "-" * 80)
+print("Test 4: Many Algorithms (12, slowest first)")
+print("-" * 80)
+algos_test4 = list(reversed(OPTIMIZED_ORDER[::3]))[:12]
+print(f"Algorithms: {', '.join(algos_test4)}")
+
+result = client.generate_multi64(TEST_TEXT, algos_test4, 1, 0, MAX_NONCE, threads=1)
+if result['success']:
+    print(f"Nonce found: {result['nonce']}")
+    reordered = client.generate_multi64(TEST_TEXT, list(reversed(algos_test4)), 1, 0, MAX_NONCE, threads=1)
+    valid = server.verify_multi(TEST_TEXT, result['nonce'], algos_test4, 1)
+    status = "PASSED" if valid and reordered['nonce'] == result['nonce'] else "FAILED"
+    print(f"\nVerification (same nonce in either order): {status}")
+else:
+    print(f"FAILED: No nonce found within {MAX_NONCE} attempts")
+
 # ============================================================================
 # PART 3: Custom Nonce Range Test
 # ============================================================================
@@ -187,10 +208,132 @@ else:
     print(f"  FAILED: No nonce found")
 
 # ============================================================================
-# PART 4: Edge Cases and Validation
+# PART 4: Multi-Threaded Search
+# ============================================================================
+print("\n" + "=" * 80)
+print("PART 4: Multi-Threaded Search")
+print("=" * 80)
+
+for algo in ["MD5", "SHA2-256"]:
+    print(f"\n{algo} (all CPUs, lowest nonce):")
+    result = client.generate_single_mt(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE, threads=0)
+    expected = client.generate_single(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE)
+    if result['success']:
+        print(f"  Nonce: {result['nonce']}")
+        same = "PASSED" if result['nonce'] == expected['nonce'] else "FAILED"
+        print(f"  Matches single-threaded nonce: {same}")
+        valid = server.verify_single(TEST_TEXT, result['nonce'], algo, DIFFICULTY)
+        status = "PASSED" if valid else "FAILED"
+        print(f"  Verification: {status}")
+    else:
+        print(f"  FAILED: No nonce found within {MAX_NONCE} attempts")
+
+print("\nSHA2-256 (4 threads, first nonce found):")
+result = client.generate_single_mt(TEST_TEXT, "SHA2-256", DIFFICULTY, 0, MAX_NONCE, threads=4, lowest=False)
+if result['success']:
+    print(f"  Nonce: {result['nonce']}")
+    valid = server.verify_single(TEST_TEXT, result['nonce'], "SHA2-256", DIFFICULTY)
+    status = "PASSED" if valid else "FAILED"
+    print(f"  Verification: {status}")
+else:
+    print(f"  FAILED: No nonce found within {MAX_NONCE} attempts")
+
+# ============================================================================
+# PART 5: 64-bit Nonces and Resumable Search
+# ============================================================================
+print("\n" + "=" * 80)
+print("PART 5: 64-bit Nonces and Resumable Search")
+print("=" * 80)
+
+start_nonce = 2**40
+print(f"\nMD5 starting at nonce {start_nonce}:")
+result = client.generate_single64(TEST_TEXT, "MD5", DIFFICULTY, start_nonce, start_nonce + MAX_NONCE)
+if result['success']:
+    print(f"  Nonce: {result['nonce']}")
+    valid = server.verify_single(TEST_TEXT, result['nonce'], "MD5", DIFFICULTY)
+    status = "PASSED" if valid else "FAILED"
+    print(f"  Verification: {status}")
+else:
+    print(f"  FAILED: No nonce found within {MAX_NONCE} attempts")
+
+# The top of the range is searched in full, on any number of workers
+top = [client.generate_multi64(TEST_TEXT, ["MD5", "SHA2-256"], 4, NONCE_MAX - 4000, NONCE_MAX, threads=t)
+       for t in (1, 4)]
+valid = server.verify_multi(TEST_TEXT, top[0]['nonce'], ["MD5", "SHA2-256"], 4)
+status = "PASSED" if top[0]['success'] and top[0]['nonce'] == top[1]['nonce'] and valid else "FAILED"
+print(f"  Search up to NONCE_MAX, 1 and 4 threads: {status}")
+
+cursor_algos = ["MD4", "MD5"]
+print(f"\nCursor over {', '.join(cursor_algos)} (saved and reloaded every 10000 nonces):")
+expected = client.generate_multi64(TEST_TEXT, cursor_algos, 8, 0, MAX_NONCE, threads=1)
+cursor = client.create_cursor(TEST_TEXT, cursor_algos, 8, 0, MAX_NONCE)
+while True:
+    cursor_status, result = cursor.run(budget=10000)
+    saved = cursor.save()
+    cursor.close()
+    cursor = client.load_cursor(saved, cursor_algos)
+    if cursor_status != CURSOR_PAUSED:
+        break
+cursor.close()
+if cursor_status == CURSOR_FOUND:
+    print(f"  Nonce: {result['nonce']}")
+    same = "PASSED" if result['nonce'] == expected['nonce'] else "FAILED"
+    print(f"  Matches uninterrupted search: {same}")
+    valid = server.verify_multi(TEST_TEXT, result['nonce'], cursor_algos, 8)
+    status = "PASSED" if valid else "FAILED"
+    print(f"  Verification: {status}")
+else:
+    print(f"  FAILED: No nonce found within {MAX_NONCE} attempts")
+
+# Cursors take as many algorithms as the other searches; results carry the
+# first 10 digests
+wide_algos = OPTIMIZED_ORDER[:16]
+expected = client.generate_multi64(TEST_TEXT, wide_algos, 1, 0, MAX_NONCE, threads=1)
+cursor = client.create_cursor(TEST_TEXT, wide_algos, 1, 0, MAX_NONCE)
+cursor = client.load_cursor(cursor.save(), wide_algos)
+cursor_status, result = cursor.run()
+cursor.close()
+same = cursor_status == CURSOR_FOUND and result['nonce'] == expected['nonce'] and result['hashes'] == expected['hashes']
+status = "PASSED" if same else "FAILED"
+print(f"  Cursor over {len(wide_algos)} algorithms, saved and reloaded: {status}")
+
+# ============================================================================
+# PART 6: Runtime CPU Dispatch
 # ============================================================================
 print("\n" + "=" * 80)
-print("PART 4: Edge Cases and Validation")
+print("PART 6: Runtime CPU Dispatch")
+print("=" * 80)
+
+print(f"\nCPU features: {', '.join(client.cpu_features()) or '(none)'}")
+dispatch_algos = ["MD4", "MD5", "SHA-1", "SHA2-256", "SHA2-512", "SHA3-256", "BLAKE2b-512", "BLAKE2sp-256", "Whirlpool", "Whirlpool-0"]
+for algo in dispatch_algos:
+    print(f"  {algo:12} : {client.hash_backend(algo)}")
+
+print("\nBest backends vs portable code (same nonces):")
+fast = [client.generate_single(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE)['nonce'] for algo in dispatch_algos]
+client.force_cpu_features([])
+portable = [client.generate_single(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE)['nonce'] for algo in dispatch_algos]
+client.force_cpu_features()
+status = "PASSED" if fast == portable else "FAILED"
+print(f"  Match: {status}")
+
+print("\nMulti-lane search kernels (SHA-NI masked off, same nonces as portable code):")
+lane_algos = ["MD4", "NT", "MD5", "RIPEMD-160", "RIPEMD-320", "SHA2-256", "SHA2-512", "SHA2-384", "SHA3-256", "Keccak-256", "SHAKE-128", "BLAKE2b-256", "BLAKE2s-256"]
+client.force_cpu_features([])
+expected = [client.generate_single(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE)['nonce'] for algo in lane_algos]
+for features in (["sse2"], ["sse2", "avx2"], ["sse2", "avx2", "avx512f"]):
+    client.force_cpu_features(features)
+    nonces = [client.generate_single(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE)['nonce'] for algo in lane_algos]
+    backends = ", ".join(f"{algo} {client.hash_backend(algo)}" for algo in lane_algos)
+    status = "PASSED" if nonces == expected else "FAILED"
+    print(f"  {features[-1]:8}: {backends}: {status}")
+client.force_cpu_features()
+
+# ============================================================================
+# PART 7: Edge Cases and Validation
+# ============================================================================
+print("\n" + "=" * 80)
+print("PART 7: Edge Cases and Validation")
 print("=" * 80)
 
 # Test with different text
@@ -217,6 +360,114 @@ valid = server.verify_single(TEST_TEXT, 999999999, "SHA2-256", DIFFICULTY)
 status = "FAILED (correctly rejected)" if not valid else "PASSED (should fail)"
 print(f"  Verifying random nonce 999999999: {status}")
 
+# Binary challenges: NUL bytes and more than 4 KB
+print("\nTest: Binary challenge (NUL bytes, 10 KB)")
+binary_text = bytes(range(256)) * 40
+result = client.generate_single64(binary_text, "SHA2-256", DIFFICULTY, 0, MAX_NONCE, threads=1)
+valid = result['success'] and server.verify_single(binary_text, result['nonce'], "SHA2-256", DIFFICULTY)
+truncated = server.verify_single(binary_text[:1], result['nonce'], "SHA2-256", DIFFICULTY)
+status = "PASSED" if valid and not truncated else "FAILED"
+print(f"  Nonce: {result['nonce']}: {status}")
+
+# One pass over a large challenge for several block sizes (16 to 136 bytes);
+# digests must match hashlib's over the whole message
+print("\nTest: Multi-digest pass (100 KB challenge, 5 algorithms)")
+large_text = bytes(range(251)) * 400
+large_algos = ["MD5", "SHA2-512", "SHA3-256", "MD2", "BLAKE2s-256"]
+result = client.generate_multi64(large_text, large_algos, 2, 0, MAX_NONCE, threads=1)
+message = large_text + str(result['nonce']).encode()
+expected = [hashlib.md5(message).digest(), hashlib.sha512(message).digest(), hashlib.sha3_256(message).digest()]
+valid = result['success'] and server.verify_multi(large_text, result['nonce'], large_algos, 2)
+wrong = server.verify_multi(large_text[:-1], result['nonce'], large_algos, 2)
+status = "PASSED" if valid and not wrong and result['hashes'][:3] == expected else "FAILED"
+print(f"  Nonce: {result['nonce']}: {status}")
+
+# Fractional difficulty: a target from any expected work, 2^d matches d bits
+print("\nTest: Target-based difficulty")
+whole = client.generate_multi64(TEST_TEXT, ["SHA2-256"], DIFFICULTY, 0, MAX_NONCE, threads=1)
+as_target = client.generate_target(TEST_TEXT, ["SHA2-256"], 2.0 ** DIFFICULTY, 0, MAX_NONCE, threads=1)
+fractional = client.generate_target(TEST_TEXT, ["MD5", "SHA-1"], 1500.5, 0, MAX_NONCE, threads=1)
+valid = server.verify_target(TEST_TEXT, fractional['nonce'], ["MD5", "SHA-1"], 1500.5)
+status = "PASSED" if whole['nonce'] == as_target['nonce'] and valid else "FAILED"
+print(f"  2^{DIFFICULTY} work nonce {as_target['nonce']}, 1500.5 work nonce {fractional['nonce']}: {status}")
+
+# Batch verification must agree with one call per submission
+print("\nTest: Batch verification")
+batch = []
+for algo in ["MD5", "SHA2-256", "SHA3-256", "BLAKE2s-256", "Whirlpool"]:
+    nonce = client.generate_single(TEST_TEXT, algo, DIFFICULTY, 0, MAX_NONCE)['nonce']
+    batch += [(TEST_TEXT, n, algo, DIFFICULTY) for n in range(max(nonce - 40, 0), nonce + 40)]
+batch += [(TEST_TEXT, n, algos_test1, DIFFICULTY) for n in range(200)]
+batch += [(b"different text", n, "SHA2-256", DIFFICULTY) for n in range(100)]
+results = server.verify_batch(batch)
+expected = [server.verify_multi(text, n, algos if isinstance(algos, list) else [algos], d)
+            for text, n, algos, d in batch]
+status = "PASSED" if results == expected and any(results) else "FAILED"
+print(f"  {len(batch)} submissions, {sum(results)} valid: {status}")
+
+# Replay protection: a solution is accepted once per ttl
+print("\nTest: Replay protection")
+store = server.create_replay_store(1024, 60)
+nonce = client.generate_single64(TEST_TEXT, "SHA2-256", DIFFICULTY, 0, MAX_NONCE)['nonce']
+codes = [store.verify_and_consume(TEST_TEXT, nonce, "SHA2-256", DIFFICULTY, now=1000),
+         store.verify_and_consume(TEST_TEXT, nonce, "SHA2-256", DIFFICULTY, now=1059),
+         store.verify_and_consume(TEST_TEXT, nonce + 1, "SHA2-256", DIFFICULTY, now=1059),
+         store.verify_and_consume(TEST_TEXT, nonce, "SHA2-256", DIFFICULTY, now=1060)]
+store.close()
+expected_codes = [VERIFY_OK, VERIFY_REPLAY, VERIFY_INVALID, VERIFY_OK]
+status = "PASSED" if codes == expected_codes else "FAILED"
+print(f"  accept, replay, invalid, accept after ttl: {status}")
+
+# Time stamps are 24 bits wide (one tick per second at this ttl); ages must
+# stay right across the wrap
+store = server.create_replay_store(1024, 60)
+wrap = 1 << 24
+codes = [store.consume(TEST_TEXT, 1, now=wrap - 30),
+         store.consume(TEST_TEXT, 1, now=wrap + 29),
+         store.consume(TEST_TEXT, 2, now=wrap + 10)]
+counts = [store.count(now=wrap + 29), store.count(now=wrap + 30), store.count(now=wrap + 69)]
+codes.append(store.consume(TEST_TEXT, 1, now=wrap + 30))
+store.close()
+expected_codes = [VERIFY_OK, VERIFY_REPLAY, VERIFY_OK, VERIFY_OK]
+status = "PASSED" if codes == expected_codes and counts == [2, 1, 1] else "FAILED"
+print(f"  replay and expiry across the time stamp wrap: {status}")
+
+# Stateless challenges: MAC, expiry and PoW checked without server state
+print("\nTest: Stateless challenges")
+key = b"example secret key (use os.urandom)"
+challenge = server.issue_challenge(key, ["MD5", "SHA2-256"], 6, 300, now=1000)
+params = server.parse_challenge(challenge)
+nonce = client.generate_multi64(challenge, params['algorithms'], params['difficulty'], 0, MAX_NONCE)['nonce']
+tampered = challenge[:-1] + ("A" if challenge[-1] != "A" else "B")
+codes = [server.verify_issued(key, challenge, nonce, now=1100),
+         server.verify_issued(key, tampered, nonce, now=1100),
+         server.verify_issued(b"another key", challenge, nonce, now=1100),
+         server.verify_issued(key, challenge, nonce, now=1301)]
+expected_codes = [VERIFY_OK, VERIFY_BAD_CHALLENGE, VERIFY_BAD_CHALLENGE, VERIFY_EXPIRED]
+status = "PASSED" if codes == expected_codes else "FAILED"
+print(f"  {challenge}")
+print(f"  accept, tampered, wrong key, expired: {status}")
+
+# Adaptive difficulty: solve times steer the difficulty, request floods raise it
+print("\nTest: Adaptive difficulty controller")
+controller = server.create_controller(["SHA2-256"], target_seconds=0.05, verify_budget=0.5, base_difficulty=DIFFICULTY)
+now = 1000.0
+for _ in range(8):
+    difficulty, algos = controller.next("client-a", now=now)
+    start = time.perf_counter()
+    solved = client.generate_multi64(TEST_TEXT, algos, difficulty, 0, MAX_NONCE, threads=1)
+    elapsed = time.perf_counter() - start
+    controller.observe("client-a", difficulty, algos, elapsed, now=now + elapsed)
+    now += 1
+print(f"  client-a settles at difficulty {difficulty} ({elapsed * 1000:.0f} ms last solve, target 50 ms)")
+fresh, _ = controller.next("client-b", now=now)
+for _ in range(2000):
+    flooded, _ = controller.next("flood", now=now)
+    now += 0.005
+status = "PASSED" if flooded > fresh and solved['success'] else "FAILED"
+print(f"  new client {fresh}, bucket flooding 200 requests/s {flooded}: {status}")
+controller.close()
+
 # ============================================================================
 # Summary
 # ============================================================================
@@ -225,17 +476,26 @@ print("Test Suite Complete!")
 print("=" * 80)
 print("\nKey Features Demonstrated:")
 print("  [OK] Single hash algorithm PoW generation and verification")
-print("  [OK] Multi-hash PoW with 4, 5, and 6 algorithms")
+print("  [OK] Multi-hash PoW with 4, 5, 6 and 12 algorithms")
 print("  [OK] Custom nonce range (starting from non-zero values)")
+print("  [OK] Multi-threaded nonce search")
+print("  [OK] 64-bit nonces and resumable search cursors")
+print("  [OK] Runtime CPU feature dispatch")
 print("  [OK] Algorithm-optimized ordering for efficiency")
 print("  [OK] Comprehensive verification tests")
+print("  [OK] Batch verification")
+print("  [OK] Target-based fractional difficulty")
+print("  [OK] Replay protection")
+print("  [OK] Stateless MAC-authenticated challenges")
+print("  [OK] Adaptive difficulty")
 print("  [OK] Edge case handling and validation")
-print("\nAll 34 hash algorithms are supported:")
+print("\nAll 38 hash algorithms are supported:")
 print("  MD2, MD4, MD5, NT Hash, HAS-160,")
 print("  RIPEMD-128/160/256/320,")
 print("  BLAKE2b-128/160/256/384/512, BLAKE2s-128/160/256,")
+print("  BLAKE2bp-512, BLAKE2sp-256,")
 print("  SHA-0, SHA-1, SHA2-224/256/384/512,")
 print("  SHA3-224/256/384/512,")
 print("  Keccak-224/256/384/512,")
-print("  SHAKE-128/256, Whirlpool")
+print("  SHAKE-128/256, Whirlpool, Whirlpool-0, Whirlpool-T")
 print("=" * 80)
@@ -20,10 +20,14 @@ HASH_ALGORITHMS = {
     'SHA3-224': 23, 'SHAKE-256': 24, 'SHA3-384': 25,
     'SHAKE-128': 26, 'Keccak-384': 27, 'Keccak-256': 28,
     'SHA3-256': 29, 'SHA3-512': 30, 'Keccak-512': 31, 'Keccak-224': 32,
-    'MD2': 33
+    'MD2': 33,
+    'BLAKE2bp-512': 34, 'BLAKE2sp-256': 35,
+    'Whirlpool-0': 36, 'Whirlpool-T': 37
 }
 
-# Optimized order for multi-hash PoW (fastest to slowest)
+# Typical order for multi-hash PoW (fastest to slowest), used to pick the
+# cheapest algorithms. Searches need not follow it: the library measures each
+# algorithm on the machine and evaluates the cheapest first.
 OPTIMIZED_ORDER = [
     'MD4', 'NT', 'MD5', 'HAS-160',
     'RIPEMD-256', 'RIPEMD-128',
@@ -33,11 +37,12 @@ OPTIMIZED_ORDER = [
     'BLAKE2b-160', 'BLAKE2b-256',
     'SHA2-256', 'SHA-0', 'SHA-1', 'SHA2-224',
     'SHA2-512', 'SHA2-384',
-    'Whirlpool',
+    'Whirlpool', 'Whirlpool-0', 'Whirlpool-T',
     'SHA3-224', 'SHAKE-256', 'SHA3-384',
     'SHAKE-128', 'Keccak-384', 'Keccak-256',
     'SHA3-256', 'SHA3-512', 'Keccak-512', 'Keccak-224',
-    'MD2'
+    'MD2',
+    'BLAKE2bp-512', 'BLAKE2sp-256'
 ]
 
 # Result structures
@@ -56,6 +61,42 @@ class MultiPoWResult(ctypes.Structure):
         ("num_hashes", ctypes.c_int)
     ]
 
+class PoWResult64(ctypes.Structure):
+    _fields_ = [
+        ("nonce", ctypes.c_int64),
+        ("hash", ctypes.c_ubyte * 128),
+        ("hash_size", ctypes.c_int)
+    ]
+
+class MultiPoWResult64(ctypes.Structure):
+    _fields_ = [
+        ("nonce", ctypes.c_int64),
+        ("hashes", (ctypes.c_ubyte * 128) * 10),
+        ("hash_sizes", ctypes.c_int * 10),
+        ("num_hashes", ctypes.c_int)
+    ]
+
+# CPU feature bits reported by pow_cpu_features (must match cpu_features.h)
+CPU_FEATURES = {
+    'sse2': 1 << 0, 'ssse3': 1 << 1, 'sse4.1': 1 << 2, 'avx2': 1 << 3,
+    'bmi2': 1 << 4, 'avx512f': 1 << 5, 'avx512bw': 1 << 6, 'avx512vl': 1 << 7,
+    'sha': 1 << 8, 'gfni': 1 << 9, 'avx512vbmi': 1 << 10,
+    'neon': 1 << 16, 'arm-sha1': 1 << 17, 'arm-sha2': 1 << 18,
+    'arm-sha3': 1 << 19, 'arm-sha512': 1 << 20
+}
+CPU_ALL = 0xFFFFFFFF
+
+# pow_cursor_run return codes (must match C code)
+CURSOR_FOUND = 1
+CURSOR_PAUSED = 0
+CURSOR_EXHAUSTED = -1
+CURSOR_ERROR = -2
+
+TARGET_BYTES = 32
+
+MAX_ALGORITHMS = 64              # per search (SEARCH_MAX_ALGOS in client.c)
+NONCE_MAX = 2**63 - 2            # largest max_nonce of a 64-bit search (SEARCH_NONCE_MAX)
+
 class PoWClient:
     def __init__(self, dll_path):
         """Initialize the PoW client with the DLL"""
@@ -95,6 +136,118 @@ class PoWClient:
             ctypes.c_int               # max_nonce
         ]
         self.client.generate_pow_multi.restype = MultiPoWResult
+        
+        # Setup function signatures for multi-threaded search
+        self.client.generate_pow_single_mt.argtypes = [
+            ctypes.c_char_p,  # input
+            ctypes.c_int,     # algo
+            ctypes.c_int,     # difficulty
+            ctypes.c_int,     # min_nonce
+            ctypes.c_int,     # max_nonce
+            ctypes.c_int,     # threads (<= 0: one per CPU)
+            ctypes.c_int      # lowest
+        ]
+        self.client.generate_pow_single_mt.restype = PoWResult
+        
+        self.client.generate_pow_multi_mt.argtypes = [
+            ctypes.c_char_p,           # input
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int,              # difficulty
+            ctypes.c_int,              # min_nonce
+            ctypes.c_int,              # max_nonce
+            ctypes.c_int,              # threads (<= 0: one per CPU)
+            ctypes.c_int               # lowest
+        ]
+        self.client.generate_pow_multi_mt.restype = MultiPoWResult
+        
+        # Length-delimited challenges (binary, any size)
+        self.client.generate_pow_single_buf.argtypes = [
+            ctypes.c_char_p,  # data
+            ctypes.c_size_t,  # length
+            ctypes.c_int,     # algo
+            ctypes.c_int,     # difficulty
+            ctypes.c_int64,   # min_nonce
+            ctypes.c_int64,   # max_nonce
+            ctypes.c_int,     # threads (<= 0: one per CPU)
+            ctypes.c_int      # lowest
+        ]
+        self.client.generate_pow_single_buf.restype = PoWResult64
+        
+        self.client.generate_pow_multi_buf.argtypes = [
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int,              # difficulty
+            ctypes.c_int64,            # min_nonce
+            ctypes.c_int64,            # max_nonce
+            ctypes.c_int,              # threads (<= 0: one per CPU)
+            ctypes.c_int               # lowest
+        ]
+        self.client.generate_pow_multi_buf.restype = MultiPoWResult64
+        
+        # Target-based (fractional) difficulty
+        self.client.generate_pow_target.argtypes = [
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_char_p,           # target (32 bytes, big-endian)
+            ctypes.c_int64,            # min_nonce
+            ctypes.c_int64,            # max_nonce
+            ctypes.c_int,              # threads (<= 0: one per CPU)
+            ctypes.c_int               # lowest
+        ]
+        self.client.generate_pow_target.restype = MultiPoWResult64
+        self.client.pow_work_target.argtypes = [ctypes.c_double, ctypes.c_char_p]
+        self.client.pow_work_target.restype = ctypes.c_int
+        
+        # Setup function signatures for resumable search cursors
+        self.client.pow_cursor_create.argtypes = [
+            ctypes.c_char_p,           # input
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int,              # difficulty
+            ctypes.c_int64,            # min_nonce
+            ctypes.c_int64             # max_nonce
+        ]
+        self.client.pow_cursor_create.restype = ctypes.c_void_p
+        self.client.pow_cursor_create_buf.argtypes = [
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int,              # difficulty
+            ctypes.c_int64,            # min_nonce
+            ctypes.c_int64             # max_nonce
+        ]
+        self.client.pow_cursor_create_buf.restype = ctypes.c_void_p
+        self.client.pow_cursor_free.argtypes = [ctypes.c_void_p]
+        self.client.pow_cursor_free.restype = None
+        self.client.pow_cursor_run.argtypes = [
+            ctypes.c_void_p,           # cursor
+            ctypes.c_int64,            # budget (<= 0: rest of the range)
+            ctypes.c_int,              # threads (<= 0: one per CPU)
+            ctypes.POINTER(MultiPoWResult64)
+        ]
+        self.client.pow_cursor_run.restype = ctypes.c_int
+        self.client.pow_cursor_pause.argtypes = [ctypes.c_void_p]
+        self.client.pow_cursor_pause.restype = None
+        self.client.pow_cursor_position.argtypes = [ctypes.c_void_p]
+        self.client.pow_cursor_position.restype = ctypes.c_int64
+        self.client.pow_cursor_save.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_size_t]
+        self.client.pow_cursor_save.restype = ctypes.c_size_t
+        self.client.pow_cursor_load.argtypes = [ctypes.c_char_p, ctypes.c_size_t]
+        self.client.pow_cursor_load.restype = ctypes.c_void_p
+        
+        # Setup function signatures for runtime CPU dispatch
+        self.client.pow_cpu_features.argtypes = []
+        self.client.pow_cpu_features.restype = ctypes.c_uint32
+        self.client.pow_force_cpu_features.argtypes = [ctypes.c_uint32]
+        self.client.pow_force_cpu_features.restype = ctypes.c_uint32
+        self.client.pow_hash_backend.argtypes = [ctypes.c_int]
+        self.client.pow_hash_backend.restype = ctypes.c_char_p
     
     def generate_single(self, text, algo_name, difficulty, min_nonce=0, max_nonce=1000000000):
         """
@@ -139,13 +292,14 @@ class PoWClient:
             max_nonce: Maximum nonce to try
         
         Returns:
-            dict with 'nonce', 'hashes', 'hash_sizes', 'success', 'algorithms'
+            dict with 'nonce', 'hashes', 'hash_sizes', 'success', 'algorithms';
+            'hashes' holds the digests of the first 10 algorithms
         """
         if isinstance(text, str):
             text = text.encode('utf-8')
         
-        if len(algo_names) > 10:
-            raise ValueError("Maximum 10 algorithms supported")
+        if len(algo_names) > MAX_ALGORITHMS:
+            raise ValueError(f"Maximum {MAX_ALGORITHMS} algorithms supported")
         
         # Convert algorithm names to IDs
         algo_ids = []
@@ -176,6 +330,202 @@ class PoWClient:
             'algorithms': algo_names
         }
     
+    def generate_single_mt(self, text, algo_name, difficulty, min_nonce=0, max_nonce=1000000000,
+                           threads=0, lowest=True):
+        """
+        Generate PoW for a single hash algorithm using a pool of worker threads
+        
+        Args:
+            text: Input text (string or bytes)
+            algo_name: Hash algorithm name (e.g., 'SHA2-256', 'MD5')
+            difficulty: Number of leading zero bits required
+            min_nonce: Starting nonce value
+            max_nonce: Maximum nonce to try
+            threads: Worker threads (0 = one per CPU)
+            lowest: Return the lowest valid nonce (same as generate_single)
+                    instead of the first one any worker finds
+        
+        Returns:
+            dict with 'nonce', 'hash', 'hash_size', 'success'
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        
+        if algo_name not in HASH_ALGORITHMS:
+            raise ValueError(f"Unknown algorithm: {algo_name}")
+        
+        algo_id = HASH_ALGORITHMS[algo_name]
+        result = self.client.generate_pow_single_mt(
+            text, algo_id, difficulty, min_nonce, max_nonce, threads, int(lowest)
+        )
+        
+        return {
+            'nonce': result.nonce,
+            'hash': bytes(result.hash[:result.hash_size]),
+            'hash_size': result.hash_size,
+            'success': result.nonce != -1,
+            'algorithm': algo_name
+        }
+    
+    def generate_multi_mt(self, text, algo_names, difficulty, min_nonce=0, max_nonce=1000000000,
+                          threads=0, lowest=True):
+        """
+        Generate multi-hash PoW using a pool of worker threads
+        
+        Args:
+            text: Input text (string or bytes)
+            algo_names: List of hash algorithm names
+            difficulty: Number of leading zero bits required for ALL hashes
+            min_nonce: Starting nonce value
+            max_nonce: Maximum nonce to try
+            threads: Worker threads (0 = one per CPU)
+            lowest: Return the lowest valid nonce (same as generate_multi)
+        
+        Returns:
+            dict with 'nonce', 'hashes', 'hash_sizes', 'success', 'algorithms';
+            'hashes' holds the digests of the first 10 algorithms
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        
+        algos_array = _algo_array(algo_names)
+        result = self.client.generate_pow_multi_mt(
+            text, algos_array, len(algos_array), difficulty, min_nonce, max_nonce, threads, int(lowest)
+        )
+        return _multi_result_dict(result, algo_names)
+    
+    def generate_single64(self, text, algo_name, difficulty, min_nonce=0, max_nonce=2**62,
+                          threads=0, lowest=True):
+        """
+        Generate PoW for a single hash algorithm over a 64-bit nonce range
+        
+        Same arguments and result as generate_single_mt; nonces may exceed 2^31
+        and bytes text may contain NULs and be of any length. The range may
+        lie anywhere in [-2**63, NONCE_MAX] and is searched in full; a larger
+        max_nonce raises ValueError.
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        _check_nonce_range(min_nonce, max_nonce)
+        
+        if algo_name not in HASH_ALGORITHMS:
+            raise ValueError(f"Unknown algorithm: {algo_name}")
+        
+        algo_id = HASH_ALGORITHMS[algo_name]
+        result = self.client.generate_pow_single_buf(
+            text, len(text), algo_id, difficulty, min_nonce, max_nonce, threads, int(lowest)
+        )
+        
+        return {
+            'nonce': result.nonce,
+            'hash': bytes(result.hash[:result.hash_size]),
+            'hash_size': result.hash_size,
+            'success': result.nonce != -1,
+            'algorithm': algo_name
+        }
+    
+    def generate_multi64(self, text, algo_names, difficulty, min_nonce=0, max_nonce=2**62,
+                         threads=0, lowest=True):
+        """
+        Generate multi-hash PoW over a 64-bit nonce range
+        
+        Same arguments and result as generate_multi_mt; nonces may exceed 2^31
+        and bytes text may contain NULs and be of any length. The range may
+        lie anywhere in [-2**63, NONCE_MAX] and is searched in full; a larger
+        max_nonce raises ValueError.
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        _check_nonce_range(min_nonce, max_nonce)
+        
+        algos_array = _algo_array(algo_names)
+        result = self.client.generate_pow_multi_buf(
+            text, len(text), algos_array, len(algos_array), difficulty, min_nonce, max_nonce, threads, int(lowest)
+        )
+        return _multi_result_dict(result, algo_names)
+    
+    def work_target(self, work):
+        """32-byte target a digest meets with probability 1 / work (work >= 1)"""
+        target = ctypes.create_string_buffer(TARGET_BYTES)
+        if not self.client.pow_work_target(work, target):
+            raise ValueError("work must be >= 1")
+        return target.raw
+    
+    def generate_target(self, text, algo_names, work, min_nonce=0, max_nonce=2**62,
+                        threads=0, lowest=True):
+        """
+        Generate PoW against a target instead of a whole number of zero bits
+        
+        Args:
+            work: Expected attempts per algorithm (any float >= 1), or a
+                32-byte big-endian target every digest must not exceed
+        
+        Other arguments and the result are as for generate_multi64.
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        target = work if isinstance(work, bytes) else self.work_target(work)
+        if len(target) != TARGET_BYTES:
+            raise ValueError(f"target must be {TARGET_BYTES} bytes")
+        _check_nonce_range(min_nonce, max_nonce)
+        
+        algos_array = _algo_array(algo_names)
+        result = self.client.generate_pow_target(
+            text, len(text), algos_array, len(algos_array), target, min_nonce, max_nonce, threads, int(lowest)
+        )
+        return _multi_result_dict(result, algo_names)
+    
+    def create_cursor(self, text, algo_names, difficulty, min_nonce=0, max_nonce=2**62):
+        """
+        Create a resumable search cursor over [min_nonce, max_nonce]
+        
+        Takes up to MAX_ALGORITHMS algorithms; as with generate_multi, run()
+        results hold the digests of the first 10. The range is limited as
+        for generate_multi64.
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        _check_nonce_range(min_nonce, max_nonce)
+        
+        algos_array = _algo_array(algo_names)
+        handle = self.client.pow_cursor_create_buf(
+            text, len(text), algos_array, len(algos_array), difficulty, min_nonce, max_nonce
+        )
+        if not handle:
+            raise ValueError("Invalid cursor parameters")
+        return SearchCursor(self.client, handle, algo_names)
+    
+    def load_cursor(self, data, algo_names=None):
+        """Restore a cursor from bytes produced by SearchCursor.save()"""
+        handle = self.client.pow_cursor_load(data, len(data))
+        if not handle:
+            raise ValueError("Malformed cursor data")
+        return SearchCursor(self.client, handle, algo_names)
+    
+    def cpu_features(self):
+        """Names of the CPU features the library currently uses"""
+        mask = self.client.pow_cpu_features()
+        return [name for name, bit in CPU_FEATURES.items() if mask & bit]
+    
+    def force_cpu_features(self, names=None):
+        """
+        Restrict the library to the given CPU features (None = all detected,
+        [] = portable code only). For testing; not while a search is running.
+        """
+        mask = CPU_ALL
+        if names is not None:
+            mask = 0
+            for name in names:
+                mask |= CPU_FEATURES[name]
+        self.client.pow_force_cpu_features(mask)
+        return self.cpu_features()
+    
+    def hash_backend(self, algo_name):
+        """Implementation selected for an algorithm ('scalar', 'sha-ni', ...)"""
+        if algo_name not in HASH_ALGORITHMS:
+            raise ValueError(f"Unknown algorithm: {algo_name}")
+        return self.client.pow_hash_backend(HASH_ALGORITHMS[algo_name]).decode()
+    
     @staticmethod
     def hash_to_hex(hash_bytes):
         """Convert hash bytes to hex string"""
@@ -189,6 +539,95 @@ class PoWClient:
         return OPTIMIZED_ORDER[:count]
 
 
+def _algo_array(algo_names, limit=MAX_ALGORITHMS):
+    """Convert algorithm names to a C int array (at most limit of them)"""
+    if len(algo_names) > limit:
+        raise ValueError(f"Maximum {limit} algorithms supported")
+    
+    algo_ids = []
+    for name in algo_names:
+        if name not in HASH_ALGORITHMS:
+            raise ValueError(f"Unknown algorithm: {name}")
+        algo_ids.append(HASH_ALGORITHMS[name])
+    
+    return (ctypes.c_int * len(algo_ids))(*algo_ids)
+
+
+def _check_nonce_range(min_nonce, max_nonce):
+    """Reject 64-bit ranges the library cannot search in full"""
+    if min_nonce < -2**63 or max_nonce > NONCE_MAX:
+        raise ValueError(f"Nonce range must lie within [-2**63, {NONCE_MAX}]")
+
+
+def _multi_result_dict(result, algo_names):
+    """Convert a MultiPoWResult(64) into the dict returned by generate_multi"""
+    hashes = []
+    hash_sizes = []
+    for i in range(result.num_hashes):
+        size = result.hash_sizes[i]
+        hashes.append(bytes(result.hashes[i][:size]))
+        hash_sizes.append(size)
+    
+    return {
+        'nonce': result.nonce,
+        'hashes': hashes,
+        'hash_sizes': hash_sizes,
+        'success': result.nonce != -1,
+        'algorithms': algo_names
+    }
+
+
+class SearchCursor:
+    """
+    Resumable multi-hash nonce search. run() searches a budget of nonces
+    from the current position; the state can be saved to bytes and loaded
+    again in another process without redoing work.
+    """
+    
+    def __init__(self, lib, handle, algo_names):
+        self._lib = lib
+        self._handle = handle
+        self.algorithms = algo_names
+    
+    def __del__(self):
+        self.close()
+    
+    def close(self):
+        if self._handle:
+            self._lib.pow_cursor_free(self._handle)
+            self._handle = None
+    
+    def run(self, budget=0, threads=0):
+        """
+        Search up to `budget` nonces (0 = the rest of the range)
+        
+        Returns:
+            (status, result) where status is CURSOR_FOUND, CURSOR_PAUSED or
+            CURSOR_EXHAUSTED and result is a generate_multi style dict
+        """
+        result = MultiPoWResult64()
+        status = self._lib.pow_cursor_run(self._handle, budget, threads, ctypes.byref(result))
+        if status == CURSOR_ERROR:
+            raise RuntimeError("Cursor search failed")
+        return status, _multi_result_dict(result, self.algorithms)
+    
+    def pause(self):
+        """Ask a run() in progress on another thread to return early"""
+        self._lib.pow_cursor_pause(self._handle)
+    
+    @property
+    def position(self):
+        """First nonce that has not been searched yet"""
+        return self._lib.pow_cursor_position(self._handle)
+    
+    def save(self):
+        """Serialize the cursor state to bytes"""
+        size = self._lib.pow_cursor_save(self._handle, None, 0)
+        buf = ctypes.create_string_buffer(size)
+        self._lib.pow_cursor_save(self._handle, buf, size)
+        return buf.raw
+
+
 def create_multi_pow_challenge(algo_count, difficulty=12):
     """
     Helper to create a multi-hash PoW challenge with optimal algorithm selection
@@ -4,7 +4,9 @@ Provides helper functions for verifying PoW with multiple hash algorithms
 """
 
 import ctypes
+import hashlib
 import os
+import struct
 
 # Hash algorithm enumeration (must match C code)
 HASH_ALGORITHMS = {
@@ -20,9 +22,43 @@ HASH_ALGORITHMS = {
     'SHA3-224': 23, 'SHAKE-256': 24, 'SHA3-384': 25,
     'SHAKE-128': 26, 'Keccak-384': 27, 'Keccak-256': 28,
     'SHA3-256': 29, 'SHA3-512': 30, 'Keccak-512': 31, 'Keccak-224': 32,
-    'MD2': 33
+    'MD2': 33,
+    'BLAKE2bp-512': 34, 'BLAKE2sp-256': 35,
+    'Whirlpool-0': 36, 'Whirlpool-T': 37
 }
 
+# One submission for verify_pow_batch (must match PowSubmission in server.c)
+class PowSubmission(ctypes.Structure):
+    _fields_ = [
+        ("input", ctypes.c_char_p),
+        ("input_len", ctypes.c_size_t),
+        ("nonce", ctypes.c_int64),
+        ("algos", ctypes.POINTER(ctypes.c_int)),
+        ("num_algos", ctypes.c_int),
+        ("difficulty", ctypes.c_int)
+    ]
+
+# verify_and_consume / ReplayStore status codes (must match C code)
+VERIFY_OK = 1
+VERIFY_INVALID = 0
+VERIFY_REPLAY = -1
+VERIFY_STORE_FULL = -2
+VERIFY_ERROR = -3
+VERIFY_BAD_CHALLENGE = -4
+VERIFY_EXPIRED = -5
+
+TARGET_BYTES = 32
+
+MAX_ALGORITHMS = 64              # the most a client search accepts
+
+CHALLENGE_SALT_BYTES = 16
+CHALLENGE_MAX = 72               # token text, including the NUL
+
+_ALGORITHM_NAMES = {algo_id: name for name, algo_id in HASH_ALGORITHMS.items()}
+
+_SUBMISSION = struct.Struct('@PNqPii')
+assert _SUBMISSION.size == ctypes.sizeof(PowSubmission)
+
 class PoWServer:
     def __init__(self, dll_path):
         """Initialize the PoW server with the DLL"""
@@ -60,14 +96,165 @@ class PoWServer:
             ctypes.c_int               # difficulty
         ]
         self.server.verify_pow_multi.restype = ctypes.c_int
+        
+        # Setup function signatures for 64-bit nonce verification
+        self.server.verify_pow_single64.argtypes = [
+            ctypes.c_char_p,  # input
+            ctypes.c_int64,   # nonce
+            ctypes.c_int,     # algo
+            ctypes.c_int      # difficulty
+        ]
+        self.server.verify_pow_single64.restype = ctypes.c_int
+        
+        self.server.verify_pow_multi64.argtypes = [
+            ctypes.c_char_p,           # input
+            ctypes.c_int64,            # nonce
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int               # difficulty
+        ]
+        self.server.verify_pow_multi64.restype = ctypes.c_int
+        
+        # Length-delimited challenges (binary, any size)
+        self.server.verify_pow_single_buf.argtypes = [
+            ctypes.c_char_p,  # data
+            ctypes.c_size_t,  # length
+            ctypes.c_int64,   # nonce
+            ctypes.c_int,     # algo
+            ctypes.c_int      # difficulty
+        ]
+        self.server.verify_pow_single_buf.restype = ctypes.c_int
+        
+        self.server.verify_pow_multi_buf.argtypes = [
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.c_int64,            # nonce
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int               # difficulty
+        ]
+        self.server.verify_pow_multi_buf.restype = ctypes.c_int
+        
+        # Target-based (fractional) difficulty
+        self.server.verify_pow_target.argtypes = [
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.c_int64,            # nonce
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_char_p            # target (32 bytes, big-endian)
+        ]
+        self.server.verify_pow_target.restype = ctypes.c_int
+        self.server.pow_work_target.argtypes = [ctypes.c_double, ctypes.c_char_p]
+        self.server.pow_work_target.restype = ctypes.c_int
+        
+        # Batch verification
+        self.server.verify_pow_batch.argtypes = [
+            ctypes.POINTER(PowSubmission),  # submissions
+            ctypes.c_size_t,                # count
+            ctypes.POINTER(ctypes.c_ubyte), # results
+            ctypes.c_int                    # threads (0 = one per CPU)
+        ]
+        self.server.verify_pow_batch.restype = ctypes.c_size_t
+        
+        # Replay protection
+        self.server.pow_replay_create.argtypes = [ctypes.c_size_t, ctypes.c_int64]
+        self.server.pow_replay_create.restype = ctypes.c_void_p
+        self.server.pow_replay_free.argtypes = [ctypes.c_void_p]
+        self.server.pow_replay_free.restype = None
+        self.server.pow_replay_consume.argtypes = [
+            ctypes.c_void_p,           # store
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.c_int64,            # nonce
+            ctypes.c_int64             # now (<= 0: current time)
+        ]
+        self.server.pow_replay_consume.restype = ctypes.c_int
+        self.server.verify_and_consume.argtypes = [
+            ctypes.c_void_p,           # store
+            ctypes.c_char_p,           # data
+            ctypes.c_size_t,           # length
+            ctypes.c_int64,            # nonce
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int,              # difficulty
+            ctypes.c_int64             # now (<= 0: current time)
+        ]
+        self.server.verify_and_consume.restype = ctypes.c_int
+        self.server.pow_replay_count.argtypes = [ctypes.c_void_p, ctypes.c_int64]
+        self.server.pow_replay_count.restype = ctypes.c_size_t
+        
+        # Stateless MAC-authenticated challenges
+        self.server.pow_challenge_issue.argtypes = [
+            ctypes.c_char_p,           # key
+            ctypes.c_size_t,           # key length (1-64)
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_int,              # difficulty
+            ctypes.c_int64,            # ttl (seconds)
+            ctypes.c_char_p,           # salt (16 bytes, NULL: from the OS)
+            ctypes.c_int64,            # now (<= 0: current time)
+            ctypes.c_char_p,           # out
+            ctypes.c_size_t            # capacity
+        ]
+        self.server.pow_challenge_issue.restype = ctypes.c_size_t
+        self.server.pow_challenge_parse.argtypes = [
+            ctypes.c_char_p,           # challenge
+            ctypes.POINTER(ctypes.c_int),  # algos (room for 10)
+            ctypes.POINTER(ctypes.c_int),  # num_algos
+            ctypes.POINTER(ctypes.c_int),  # difficulty
+            ctypes.POINTER(ctypes.c_int64) # expires
+        ]
+        self.server.pow_challenge_parse.restype = ctypes.c_int
+        self.server.pow_challenge_verify.argtypes = [
+            ctypes.c_char_p,           # key
+            ctypes.c_size_t,           # key length
+            ctypes.c_char_p,           # challenge
+            ctypes.c_int64,            # nonce
+            ctypes.c_void_p,           # replay store (NULL: none)
+            ctypes.c_int64             # now (<= 0: current time)
+        ]
+        self.server.pow_challenge_verify.restype = ctypes.c_int
+        
+        # Adaptive difficulty
+        self.server.pow_controller_create.argtypes = [
+            ctypes.POINTER(ctypes.c_int),  # algos array
+            ctypes.c_int,              # num_algos
+            ctypes.c_double,           # target solve time (seconds)
+            ctypes.c_double,           # verify budget (CPU seconds per second)
+            ctypes.c_int,              # min_difficulty
+            ctypes.c_int,              # max_difficulty
+            ctypes.c_int,              # base_difficulty
+            ctypes.c_size_t            # buckets
+        ]
+        self.server.pow_controller_create.restype = ctypes.c_void_p
+        self.server.pow_controller_free.argtypes = [ctypes.c_void_p]
+        self.server.pow_controller_free.restype = None
+        self.server.pow_controller_observe.argtypes = [
+            ctypes.c_void_p,           # controller
+            ctypes.c_uint64,           # bucket
+            ctypes.c_int,              # difficulty
+            ctypes.c_int,              # num_algos
+            ctypes.c_double,           # solve time (seconds)
+            ctypes.c_double            # now (<= 0: current time)
+        ]
+        self.server.pow_controller_observe.restype = None
+        self.server.pow_controller_next.argtypes = [
+            ctypes.c_void_p,           # controller
+            ctypes.c_uint64,           # bucket
+            ctypes.POINTER(ctypes.c_int),  # algos (room for 10)
+            ctypes.POINTER(ctypes.c_int),  # num_algos
+            ctypes.c_double            # now (<= 0: current time)
+        ]
+        self.server.pow_controller_next.restype = ctypes.c_int
     
     def verify_single(self, text, nonce, algo_name, difficulty):
         """
         Verify PoW for a single hash algorithm
         
         Args:
-            text: Input text (string or bytes)
-            nonce: The nonce to verify
+            text: Input text (string or bytes; bytes may contain NULs)
+            nonce: The nonce to verify (64-bit)
             algo_name: Hash algorithm name (e.g., 'SHA2-256', 'MD5')
             difficulty: Number of leading zero bits required
         
@@ -81,7 +268,7 @@ class PoWServer:
             raise ValueError(f"Unknown algorithm: {algo_name}")
         
         algo_id = HASH_ALGORITHMS[algo_name]
-        result = self.server.verify_pow_single(text, nonce, algo_id, difficulty)
+        result = self.server.verify_pow_single_buf(text, len(text), nonce, algo_id, difficulty)
         
         return result == 1
     
@@ -90,8 +277,8 @@ class PoWServer:
         Verify PoW for multiple hash algorithms (all must satisfy difficulty)
         
         Args:
-            text: Input text (string or bytes)
-            nonce: The nonce to verify
+            text: Input text (string or bytes; bytes may contain NULs)
+            nonce: The nonce to verify (64-bit)
             algo_names: List of hash algorithm names
             difficulty: Number of leading zero bits required for ALL hashes
         
@@ -101,8 +288,8 @@ class PoWServer:
         if isinstance(text, str):
             text = text.encode('utf-8')
         
-        if len(algo_names) > 10:
-            raise ValueError("Maximum 10 algorithms supported")
+        if len(algo_names) > MAX_ALGORITHMS:
+            raise ValueError(f"Maximum {MAX_ALGORITHMS} algorithms supported")
         
         # Convert algorithm names to IDs
         algo_ids = []
@@ -114,12 +301,178 @@ class PoWServer:
         # Create C array
         algos_array = (ctypes.c_int * len(algo_ids))(*algo_ids)
         
-        result = self.server.verify_pow_multi(
-            text, nonce, algos_array, len(algo_ids), difficulty
+        result = self.server.verify_pow_multi_buf(
+            text, len(text), nonce, algos_array, len(algo_ids), difficulty
         )
         
         return result == 1
     
+    def work_target(self, work):
+        """32-byte target a digest meets with probability 1 / work (work >= 1)"""
+        target = ctypes.create_string_buffer(TARGET_BYTES)
+        if not self.server.pow_work_target(work, target):
+            raise ValueError("work must be >= 1")
+        return target.raw
+    
+    def verify_target(self, text, nonce, algo_names, work):
+        """
+        Verify PoW against a target: every digest, as a big-endian number,
+        must be <= target
+        
+        Args:
+            work: Expected attempts per algorithm (float >= 1) or a 32-byte target
+        
+        Returns:
+            bool: True if valid, False otherwise
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        if isinstance(algo_names, str):
+            algo_names = [algo_names]
+        target = work if isinstance(work, bytes) else self.work_target(work)
+        if len(target) != TARGET_BYTES:
+            raise ValueError(f"target must be {TARGET_BYTES} bytes")
+        
+        algos_array = _algo_array(algo_names)
+        return self.server.verify_pow_target(text, len(text), nonce, algos_array, len(algos_array), target) == 1
+    
+    def verify_batch(self, submissions, threads=0):
+        """
+        Verify many submissions in one call
+        
+        Args:
+            submissions: Iterable of (text, nonce, algorithms, difficulty)
+                tuples; algorithms is a name or a list of names (all must pass)
+            threads: Worker threads (0 = one per CPU)
+        
+        Returns:
+            list: One bool per submission, in order
+        """
+        # Packing the records with struct is several times faster than
+        # filling PowSubmission objects one by one
+        texts = {}      # text -> (bytes the records point into, address)
+        algo_arrays = {}
+        records = []
+        
+        for text, nonce, algos, difficulty in submissions:
+            entry = texts.get(text)
+            if entry is None:
+                data = text.encode('utf-8') if isinstance(text, str) else bytes(text)
+                entry = texts[text] = (data, ctypes.cast(ctypes.c_char_p(data), ctypes.c_void_p).value or 0)
+            names = (algos,) if isinstance(algos, str) else tuple(algos)
+            algo_entry = algo_arrays.get(names)
+            if algo_entry is None:
+                if len(names) > MAX_ALGORITHMS:
+                    raise ValueError(f"Maximum {MAX_ALGORITHMS} algorithms supported")
+                for name in names:
+                    if name not in HASH_ALGORITHMS:
+                        raise ValueError(f"Unknown algorithm: {name}")
+                ids = (ctypes.c_int * len(names))(*[HASH_ALGORITHMS[n] for n in names])
+                algo_entry = algo_arrays[names] = (ids, ctypes.addressof(ids), len(names))
+            records.append(_SUBMISSION.pack(entry[1], len(entry[0]), nonce, algo_entry[1], algo_entry[2], difficulty))
+        
+        count = len(records)
+        array = (PowSubmission * count).from_buffer_copy(b''.join(records)) if count else None
+        results = (ctypes.c_ubyte * count)()
+        self.server.verify_pow_batch(array, count, results, threads)
+        return [r == 1 for r in results]
+    
+    def create_replay_store(self, capacity, ttl):
+        """
+        Create a store that accepts each (text, nonce) at most once per
+        `ttl` seconds; size `capacity` for about twice the solutions
+        expected per ttl
+        """
+        handle = self.server.pow_replay_create(capacity, ttl)
+        if not handle:
+            raise ValueError("Invalid replay store parameters")
+        return ReplayStore(self.server, handle)
+    
+    def issue_challenge(self, key, algo_names, difficulty, ttl, now=0):
+        """
+        Issue a stateless challenge token authenticated with `key`
+        
+        Args:
+            key: Secret MAC key (1-64 bytes), shared by all verifying servers
+            algo_names: Algorithm name or list of names (all must pass)
+            difficulty: Number of leading zero bits required (0-255)
+            ttl: Seconds until the challenge expires
+            now: Time in seconds (0 = current time)
+        
+        Returns:
+            str: The challenge text the client must solve
+        """
+        if isinstance(algo_names, str):
+            algo_names = [algo_names]
+        algos_array = _algo_array(algo_names, limit=10)
+        out = ctypes.create_string_buffer(CHALLENGE_MAX)
+        salt = os.urandom(CHALLENGE_SALT_BYTES)
+        size = self.server.pow_challenge_issue(
+            key, len(key), algos_array, len(algos_array), difficulty, ttl, salt, now, out, len(out)
+        )
+        if size == 0 or size > len(out):
+            raise ValueError("Invalid challenge parameters")
+        return out.value.decode('ascii')
+    
+    def parse_challenge(self, challenge):
+        """
+        Read a challenge's algorithms, difficulty and expiry (not authenticated)
+        
+        Returns:
+            dict with 'algorithms', 'difficulty', 'expires'
+        """
+        if isinstance(challenge, str):
+            challenge = challenge.encode('ascii')
+        algos = (ctypes.c_int * 10)()
+        num_algos, difficulty, expires = ctypes.c_int(), ctypes.c_int(), ctypes.c_int64()
+        if not self.server.pow_challenge_parse(challenge, algos, ctypes.byref(num_algos),
+                                               ctypes.byref(difficulty), ctypes.byref(expires)):
+            raise ValueError("Malformed challenge")
+        return {
+            'algorithms': [_ALGORITHM_NAMES[algos[i]] for i in range(num_algos.value)],
+            'difficulty': difficulty.value,
+            'expires': expires.value
+        }
+    
+    def verify_issued(self, key, challenge, nonce, store=None, now=0):
+        """
+        Verify a solution to a challenge from issue_challenge: MAC, expiry
+        and PoW in one call, consuming it in `store` (a ReplayStore) if given
+        
+        Returns:
+            int: VERIFY_OK (accept), VERIFY_INVALID, VERIFY_BAD_CHALLENGE,
+            VERIFY_EXPIRED, VERIFY_REPLAY or VERIFY_STORE_FULL
+        """
+        if isinstance(challenge, str):
+            challenge = challenge.encode('ascii', 'replace')
+        handle = store._handle if store is not None else None
+        return self.server.pow_challenge_verify(key, len(key), challenge, nonce, handle, now)
+    
+    def create_controller(self, algo_names, target_seconds, verify_budget, min_difficulty=1,
+                          max_difficulty=64, base_difficulty=12, buckets=4096):
+        """
+        Create an adaptive difficulty controller
+        
+        Args:
+            algo_names: Algorithms to draw challenges from, in the order they
+                are added while the verify budget allows
+            target_seconds: Solve time to aim for
+            verify_budget: CPU seconds per second to spend on verification
+            min_difficulty, max_difficulty: Range of difficulties to emit
+            base_difficulty: Bits of work for clients not seen before
+            buckets: Number of clients tracked (least recently seen go first)
+        """
+        if isinstance(algo_names, str):
+            algo_names = [algo_names]
+        algos_array = _algo_array(algo_names, limit=10)
+        handle = self.server.pow_controller_create(
+            algos_array, len(algos_array), target_seconds, verify_budget,
+            min_difficulty, max_difficulty, base_difficulty, buckets
+        )
+        if not handle:
+            raise ValueError("Invalid controller parameters")
+        return DifficultyController(self.server, handle)
+    
     def verify_challenge(self, challenge_data):
         """
         Verify a PoW challenge from standardized format
@@ -149,6 +502,121 @@ class PoWServer:
             raise ValueError("algorithms must be a string or list")
 
 
+def _bucket_id(bucket):
+    """64-bit bucket id for an int, str or bytes client key"""
+    if isinstance(bucket, int):
+        return bucket & 0xFFFFFFFFFFFFFFFF
+    if isinstance(bucket, str):
+        bucket = bucket.encode('utf-8')
+    return int.from_bytes(hashlib.blake2b(bucket, digest_size=8).digest(), 'little')
+
+
+def _algo_array(algo_names, limit=MAX_ALGORITHMS):
+    """Convert algorithm names to a C int array (at most limit of them)"""
+    if len(algo_names) > limit:
+        raise ValueError(f"Maximum {limit} algorithms supported")
+    
+    algo_ids = []
+    for name in algo_names:
+        if name not in HASH_ALGORITHMS:
+            raise ValueError(f"Unknown algorithm: {name}")
+        algo_ids.append(HASH_ALGORITHMS[name])
+    
+    return (ctypes.c_int * len(algo_ids))(*algo_ids)
+
+
+class ReplayStore:
+    """
+    In-process replay protection: remembers accepted solutions for the ttl
+    given to PoWServer.create_replay_store. Safe to share between threads.
+    """
+    
+    def __init__(self, lib, handle):
+        self._lib = lib
+        self._handle = handle
+    
+    def __del__(self):
+        self.close()
+    
+    def close(self):
+        if self._handle:
+            self._lib.pow_replay_free(self._handle)
+            self._handle = None
+    
+    def verify_and_consume(self, text, nonce, algo_names, difficulty, now=0):
+        """
+        Verify a solution and mark it as used
+        
+        Args:
+            text: Input text (string or bytes)
+            nonce: The nonce to verify (64-bit)
+            algo_names: Algorithm name or list of names (all must pass)
+            difficulty: Number of leading zero bits required
+            now: Time in seconds (0 = current time)
+        
+        Returns:
+            int: VERIFY_OK (accept), VERIFY_INVALID, VERIFY_REPLAY or
+            VERIFY_STORE_FULL
+        """
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        if isinstance(algo_names, str):
+            algo_names = [algo_names]
+        algos_array = _algo_array(algo_names)
+        return self._lib.verify_and_consume(
+            self._handle, text, len(text), nonce, algos_array, len(algo_names), difficulty, now
+        )
+    
+    def consume(self, text, nonce, now=0):
+        """Mark (text, nonce) as used without verifying it; VERIFY_OK if it was new"""
+        if isinstance(text, str):
+            text = text.encode('utf-8')
+        return self._lib.pow_replay_consume(self._handle, text, len(text), nonce, now)
+    
+    def count(self, now=0):
+        """Number of live entries"""
+        return self._lib.pow_replay_count(self._handle, now)
+
+
+class DifficultyController:
+    """
+    Picks each challenge's difficulty and algorithms from observed solve
+    times and request rates (see pow_controller_create). Buckets are any
+    client key: an id, an IP address, a subnet string. Thread-safe.
+    """
+    
+    def __init__(self, lib, handle):
+        self._lib = lib
+        self._handle = handle
+    
+    def __del__(self):
+        self.close()
+    
+    def close(self):
+        if self._handle:
+            self._lib.pow_controller_free(self._handle)
+            self._handle = None
+    
+    def next(self, bucket, now=0):
+        """
+        Parameters for the next challenge issued to `bucket`; counts as a request
+        
+        Returns:
+            (difficulty, algorithm names)
+        """
+        algos = (ctypes.c_int * 10)()
+        num_algos = ctypes.c_int()
+        difficulty = self._lib.pow_controller_next(self._handle, _bucket_id(bucket), algos,
+                                                   ctypes.byref(num_algos), now)
+        return difficulty, [_ALGORITHM_NAMES[algos[i]] for i in range(num_algos.value)]
+    
+    def observe(self, bucket, difficulty, algo_names, solve_seconds, now=0):
+        """Record that `bucket` solved a challenge of these parameters in solve_seconds"""
+        num_algos = 1 if isinstance(algo_names, str) else len(algo_names)
+        self._lib.pow_controller_observe(self._handle, _bucket_id(bucket), difficulty, num_algos,
+                                         solve_seconds, now)
+
+
 # Example usage
 if __name__ == "__main__":
     # Get the DLL path (same logic as main.py)
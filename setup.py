@@ -11,7 +11,7 @@ long_description = readme_path.read_text(encoding="utf-8") if readme_path.exists
 setup(
     name="proof-of-work",
     version="1.0.0",
-    description="High-performance Proof-of-Work library with support for 34 hash algorithms",
+    description="High-performance Proof-of-Work library with support for 38 hash algorithms",
     long_description=long_description,
     long_description_content_type="text/markdown",
     author="QudsLab",
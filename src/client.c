@@ -2,49 +2,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <limits.h>
+#include <stdatomic.h>
 #include "export.h"
+#include "threads.h"
+#include "nonce.h"
+#include "target.h"
 
-// Include all hash headers
-#include "crypto/md2/md2.h"
-#include "crypto/md4/md4.h"
-#include "crypto/md5/md5.h"
-#include "crypto/sha0/sha0.h"
-#include "crypto/sha1/sha1.h"
-#include "crypto/sha224/sha224.h"
-#include "crypto/sha256/sha256.h"
-#include "crypto/sha512/sha512.h"
-#include "crypto/sha3/sha3.h"
-#include "crypto/sha3_224/sha3_224.h"
-#include "crypto/sha3_384/sha3_384.h"
-#include "crypto/keccak/keccak.h"
-#include "crypto/shake/shake.h"
-#include "crypto/ripemd/ripemd160.h"
-#include "crypto/ripemd128/ripemd128.h"
-#include "crypto/ripemd256/ripemd256.h"
-#include "crypto/ripemd320/ripemd320.h"
-#include "crypto/blake2b/blake2b.h"
-#include "crypto/blake2s/blake2s.h"
-#include "crypto/whirlpool/whirlpool.h"
-#include "crypto/has160/has160.h"
-#include "crypto/nt/nt.h"
-
-// Hash algorithm enumeration
-typedef enum {
-    HASH_MD4, HASH_NT, HASH_MD5, HASH_HAS160,
-    HASH_RIPEMD256, HASH_RIPEMD128,
-    HASH_BLAKE2S_128, HASH_BLAKE2S_160, HASH_BLAKE2S_256,
-    HASH_BLAKE2B_512, HASH_RIPEMD320,
-    HASH_BLAKE2B_128, HASH_BLAKE2B_384, HASH_RIPEMD160,
-    HASH_BLAKE2B_160, HASH_BLAKE2B_256,
-    HASH_SHA256, HASH_SHA0, HASH_SHA1, HASH_SHA224,
-    HASH_SHA512, HASH_SHA384,
-    HASH_WHIRLPOOL,
-    HASH_SHA3_224, HASH_SHAKE256, HASH_SHA3_384,
-    HASH_SHAKE128, HASH_KECCAK384, HASH_KECCAK256,
-    HASH_SHA3_256, HASH_SHA3_512, HASH_KECCAK512, HASH_KECCAK224,
-    HASH_MD2,
-    HASH_COUNT
-} HashAlgorithm;
+// All hash algorithms, through the shared registry
+#include "crypto/registry/hash_registry.h"
 
 // Result structure
 typedef struct {
@@ -56,279 +22,740 @@ typedef struct {
 // Multi-hash result structure
 typedef struct {
     int nonce;
-    uint8_t hashes[10][128]; // Support up to 10 hashes
+    uint8_t hashes[10][128]; // Digests of the first 10 algorithms
     int hash_sizes[10];
     int num_hashes;
 } MultiPoWResult;
 
-// Compute hash based on algorithm
-void compute_hash(HashAlgorithm algo, const uint8_t *data, size_t len, uint8_t *digest, int *digest_size) {
-    memset(digest, 0, 128);
-    
-    switch(algo) {
-        case HASH_MD2: 
-            md2_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_MD4: 
-            md4_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_MD5: 
-            md5_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_SHA0: 
-            sha0_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_SHA1: 
-            sha1_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_SHA224: 
-            sha224_hash(data, len, digest); 
-            *digest_size = 28;
-            break;
-        case HASH_SHA256: 
-            sha256(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_SHA384: 
-            sha384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_SHA512: 
-            sha512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_SHA3_224: 
-            sha3_224_hash(data, len, digest); 
-            *digest_size = 28;
-            break;
-        case HASH_SHA3_256: 
-            sha3_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_SHA3_384: 
-            sha3_384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_SHA3_512: 
-            sha3_512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_KECCAK224: 
-            keccak_224_hash(data, len, digest); 
-            *digest_size = 28;
-            break;
-        case HASH_KECCAK256: 
-            keccak_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_KECCAK384: 
-            keccak_384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_KECCAK512: 
-            keccak_512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_SHAKE128: 
-            shake128_hash(data, len, digest, 32); 
-            *digest_size = 32;
-            break;
-        case HASH_SHAKE256: 
-            shake256_hash(data, len, digest, 64); 
-            *digest_size = 64;
-            break;
-        case HASH_RIPEMD128: 
-            ripemd128_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_RIPEMD160: 
-            ripemd160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_RIPEMD256: 
-            ripemd256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_RIPEMD320: 
-            ripemd320_hash(data, len, digest); 
-            *digest_size = 40;
-            break;
-        case HASH_BLAKE2B_128: 
-            blake2b_128_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_BLAKE2B_160: 
-            blake2b_160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_BLAKE2B_256: 
-            blake2b_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_BLAKE2B_384: 
-            blake2b_384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_BLAKE2B_512: 
-            blake2b_512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_BLAKE2S_128: 
-            blake2s_128_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_BLAKE2S_160: 
-            blake2s_160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_BLAKE2S_256: 
-            blake2s_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_WHIRLPOOL: 
-            whirlpool_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_HAS160: 
-            has160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_NT: 
-            nt_hash((const char *)data, digest); 
-            *digest_size = 16;
-            break;
-        default: 
-            *digest_size = 0;
-            break;
-    }
+// 64-bit nonce variants of the result structures
+typedef struct {
+    int64_t nonce;
+    uint8_t hash[128];
+    int hash_size;
+} PoWResult64;
+
+typedef struct {
+    int64_t nonce;
+    uint8_t hashes[10][128];
+    int hash_sizes[10];
+    int num_hashes;
+} MultiPoWResult64;
+
+// Nonces handed to a worker per claim; small enough that the lowest-nonce
+// mode wastes little work once a solution is known
+#define SEARCH_CHUNK 4096
+#define SEARCH_NONE LLONG_MAX
+
+// Largest usable max_nonce. LLONG_MAX itself marks "no solution", and a
+// finished cursor's position is max_nonce + 1. Larger ranges are rejected,
+// not clamped; below it the whole signed 64-bit range can be searched.
+#define SEARCH_NONCE_MAX (LLONG_MAX - 1)
+
+// Algorithms per search. Their states live on the heap, so this is only a
+// sanity bound; a MultiPoWResult carries the digests of the first
+// RESULT_MAX_HASHES of them.
+#define SEARCH_MAX_ALGOS 64
+#define RESULT_MAX_HASHES 10
+
+// What a search needs besides the range: the algorithms, the challenge
+// absorbed once into each of them, and the order to evaluate them in. Built
+// per search, or kept by a cursor for as long as the backends it was built
+// for stay selected.
+typedef struct {
+    const HashDescriptor **descs;   // num_algos, resolved once
+    HashState *mid;                 // shared by all workers
+    int *order;                     // evaluation order, cheapest rejection first
+    unsigned generation;            // hash_registry_generation() it was built under
+} SearchPlan;
+
+// Shared state of one nonce search (single- or multi-threaded). The arrays
+// are allocated by run_search and freed by search_release.
+typedef struct {
+    const uint8_t *input;           // challenge, hashed in place
+    size_t len;
+    const HashDescriptor *const *descs; // from the plan
+    const HashState *mid;
+    const int *order;
+    SearchPlan own;                 // the plan, unless the caller passed one
+    int num_algos;
+    int difficulty;                 // leading zero bits; with a target, its prefilter
+    int use_target;                 // digests must also be <= target
+    uint8_t target[POW_TARGET_BYTES];
+    long long min_nonce;
+    long long max_nonce;
+    unsigned long long chunks;      // SEARCH_CHUNK-sized pieces of the range, the last one partial
+    int lowest;                     // return the lowest solution, not the first one seen
+    atomic_int *pause;              // optional: stop claiming new chunks when set
+    atomic_ullong next;             // next unclaimed chunk (counts past chunks when done)
+    atomic_llong best;              // best solution so far, SEARCH_NONE if none
+    pow_mutex_t lock;               // guards hashes/hash_sizes
+    uint8_t (*hashes)[128];         // digests of the best solution, in the caller's order
+    int *hash_sizes;
+} SearchJob;
+
+// One worker's digest buffers (num_algos of each)
+typedef struct {
+    SearchJob *job;
+    uint8_t (*hashes)[128];
+    int *sizes;
+} SearchWorker;
+
+static int search_passes(const SearchJob *job, uint8_t *hash, int hash_size) {
+    if (job->use_target) return pow_meets_target(hash, hash_size, job->target);
+    return pow_has_leading_zeros(hash, hash_size, job->difficulty);
 }
 
-// Check leading zeros
-int has_leading_zeros(uint8_t *hash, int hash_size, int difficulty) {
-    int zeros = 0;
-    for (int i = 0; i < hash_size; i++) {
-        for (int bit = 7; bit >= 0; bit--) {
-            if ((hash[i] >> bit) & 1) return zeros >= difficulty;
-            zeros++;
-            if (zeros >= difficulty) return 1;
+// Record a solution unless a lower one is already known
+static void search_found(SearchJob *job, long long nonce, uint8_t hashes[][128], const int *sizes) {
+    pow_mutex_lock(&job->lock);
+    long long best = atomic_load(&job->best);
+    if (best == SEARCH_NONE || nonce < best) {
+        for (int i = 0; i < job->num_algos; i++) {
+            memcpy(job->hashes[i], hashes[i], sizes[i]);
+            job->hash_sizes[i] = sizes[i];
         }
+        atomic_store(&job->best, nonce);
     }
-    return zeros >= difficulty;
+    pow_mutex_unlock(&job->lock);
 }
 
-// Generate PoW for a single hash algorithm
-EXPORT PoWResult generate_pow_single(const char *input, HashAlgorithm algo, int difficulty, int min_nonce, int max_nonce) {
-    PoWResult result;
-    result.nonce = -1;
-    memset(result.hash, 0, 128);
-    result.hash_size = 0;
-    
-    uint8_t hash[128];
-    int hash_size;
-    char combined[4096];
-    size_t len = strlen(input);
-    memcpy(combined, input, len);
-    
-    for (int nonce = min_nonce; nonce <= max_nonce; nonce++) {
-        int n = snprintf(combined + len, sizeof(combined) - len, "%d", nonce);
-        compute_hash(algo, (uint8_t*)combined, len + n, hash, &hash_size);
-        
-        if (has_leading_zeros(hash, hash_size, difficulty)) {
-            result.nonce = nonce;
-            memcpy(result.hash, hash, hash_size);
-            result.hash_size = hash_size;
-            break;
+// Single-algorithm chunk through a multi-lane kernel: consecutive nonces with
+// the same number of digits are hashed d->lanes at a time
+static int search_chunk_lanes(SearchJob *job, const HashState *mid, long long start, long long end) {
+    const HashDescriptor *d = job->descs[0];
+    char tails[HASH_MAX_LANES][NONCE_DIGITS_MAX];
+    const uint8_t *lane_tails[HASH_MAX_LANES];
+    uint8_t digests[HASH_MAX_LANES * HASH_MAX_DIGEST];
+    uint8_t found[1][128];
+    NonceDigits digits;
+
+    nonce_digits_set(&digits, start);
+    for (long long nonce = start; nonce <= end; ) {
+        long long best = atomic_load_explicit(&job->best, memory_order_relaxed);
+        if (best != SEARCH_NONE && (!job->lowest || best < nonce)) return 1;
+
+        // digits always holds the next nonce to place in a lane
+        size_t tail_len = nonce_digits_len(&digits);
+        int n = 0;
+        while (n < d->lanes && nonce + n <= end && nonce_digits_len(&digits) == tail_len) {
+            memcpy(tails[n], nonce_digits_str(&digits), tail_len);
+            lane_tails[n] = (const uint8_t*)tails[n];
+            n++;
+            nonce_digits_inc(&digits);
+        }
+        // Short groups (range end, digit count change) repeat lane 0
+        for (int i = n; i < d->lanes; i++) lane_tails[i] = lane_tails[0];
+
+        uint32_t mask = d->finish_lanes(mid, lane_tails, tail_len, job->difficulty, digests);
+        mask &= (1u << n) - 1;
+        // The kernel tested the target's leading zeros; finish the comparison
+        for (uint32_t m = job->use_target ? mask : 0; m; m &= m - 1) {
+            int lane = 0;
+            while (!(m & (1u << lane))) lane++;
+            if (!pow_meets_target(digests + lane * d->digest_size, d->digest_size, job->target)) mask &= ~(1u << lane);
+        }
+        if (mask) {
+            int lane = 0;
+            while (!(mask & (1u << lane))) lane++;
+            memcpy(found[0], digests + lane * d->digest_size, d->digest_size);
+            search_found(job, nonce + lane, found, &d->digest_size);
+            return 1;
         }
+        nonce += n;
     }
-    
-    return result;
+    return 0;
 }
 
-// Generate PoW for multiple hash algorithms (all must pass)
-EXPORT MultiPoWResult generate_pow_multi(const char *input, HashAlgorithm *algos, int num_algos, int difficulty, int min_nonce, int max_nonce) {
-    MultiPoWResult result;
-    result.nonce = -1;
-    result.num_hashes = num_algos;
-    memset(result.hashes, 0, sizeof(result.hashes));
-    memset(result.hash_sizes, 0, sizeof(result.hash_sizes));
-    
-    if (num_algos > 10) num_algos = 10;
-    
-    char combined[4096];
-    size_t len = strlen(input);
-    memcpy(combined, input, len);
-    
-    for (int nonce = min_nonce; nonce <= max_nonce; nonce++) {
-        int n = snprintf(combined + len, sizeof(combined) - len, "%d", nonce);
+// Test every nonce of [start, end]; returns 1 if the search should stop
+static int search_chunk(SearchWorker *w, long long start, long long end) {
+    SearchJob *job = w->job;
+    const HashState *mid = job->mid;
+    NonceDigits digits;
+
+    if (job->num_algos == 1 && job->descs[0]->finish_lanes) {
+        return search_chunk_lanes(job, mid, start, end);
+    }
+
+    nonce_digits_set(&digits, start);
+    for (long long nonce = start; nonce <= end; nonce++) {
+        // Stop once another worker holds a solution we cannot beat
+        long long best = atomic_load_explicit(&job->best, memory_order_relaxed);
+        if (best != SEARCH_NONE && (!job->lowest || best < nonce)) return 1;
+
+        if (nonce != start) nonce_digits_inc(&digits);
+        const uint8_t *tail = (const uint8_t*)nonce_digits_str(&digits);
+        size_t tail_len = nonce_digits_len(&digits);
         int all_passed = 1;
-        
-        uint8_t temp_hashes[10][128];
-        int temp_sizes[10];
-        
-        // Check all algorithms
-        for (int i = 0; i < num_algos; i++) {
-            compute_hash(algos[i], (uint8_t*)combined, len + n, temp_hashes[i], &temp_sizes[i]);
-            
-            if (!has_leading_zeros(temp_hashes[i], temp_sizes[i], difficulty)) {
+
+        for (int k = 0; k < job->num_algos; k++) {
+            int i = job->order[k];
+            const HashDescriptor *d = job->descs[i];
+            w->sizes[i] = d->digest_size;
+
+            // Most nonces are rejected on the state words, before any digest is written
+            if (!hash_finish_zeros(d, &mid[i], tail, tail_len, job->difficulty, w->hashes[i]) ||
+                !search_passes(job, w->hashes[i], w->sizes[i])) {
                 all_passed = 0;
                 break;
             }
         }
-        
-        // If all passed, save results
+
         if (all_passed) {
-            result.nonce = nonce;
-            for (int i = 0; i < num_algos; i++) {
-                memcpy(result.hashes[i], temp_hashes[i], temp_sizes[i]);
-                result.hash_sizes[i] = temp_sizes[i];
-            }
-            break;
+            search_found(job, nonce, w->hashes, w->sizes);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Worker: claim chunks of the nonce range until it is exhausted or solved
+static void search_worker(void *arg) {
+    SearchWorker *w = (SearchWorker *)arg;
+    SearchJob *job = w->job;
+
+    for (;;) {
+        // Pausing only stops new claims: every claimed chunk is finished, so
+        // the searched range stays contiguous and resumable from job->next
+        if (job->pause && atomic_load(job->pause)) break;
+
+        // Claims count chunks rather than nonces, so they cannot overflow
+        // at either end of the 64-bit range
+        unsigned long long chunk = atomic_fetch_add(&job->next, 1);
+        if (chunk >= job->chunks) break;
+        long long start = (long long)((unsigned long long)job->min_nonce + chunk * SEARCH_CHUNK);
+
+        // Chunks are claimed in increasing order, so anything past the best
+        // solution cannot improve on it
+        long long best = atomic_load(&job->best);
+        if (best != SEARCH_NONE && (!job->lowest || start > best)) break;
+
+        long long end = chunk == job->chunks - 1 ? job->max_nonce : start + SEARCH_CHUNK - 1;
+        if (search_chunk(w, start, end) && !job->lowest) break;
+    }
+}
+
+// Cost of finishing one nonce per algorithm, as (registry generation << 32)
+// | nanoseconds per 8 finishes; measured on first use and again after the
+// backends are reselected
+static atomic_ullong search_costs[HASH_COUNT];
+
+// Every algorithm is timed on the same fixed prefix, tail and difficulty:
+// the order only needs their costs relative to each other, and those do
+// not depend on the challenge enough to be worth timing per search
+static unsigned search_cost(const HashDescriptor *d, unsigned generation) {
+    static const uint8_t prefix[64];
+    static const uint8_t tail[] = "1234567";
+    uint8_t digest[HASH_MAX_DIGEST];
+    HashState mid;
+
+    unsigned long long cached = atomic_load(&search_costs[d->id]);
+    if (cached >> 32 == generation) return (unsigned)cached;
+
+    hash_midstate(d, &mid, prefix, sizeof(prefix));
+    // Best of a few short runs: the minimum is the least disturbed one
+    unsigned long long cost = ~0ULL;
+    for (int run = 0; run < 3; run++) {
+        unsigned long long t0 = pow_clock_ns();
+        for (int k = 0; k < 8; k++) hash_finish_zeros(d, &mid, tail, sizeof(tail) - 1, 8, digest);
+        unsigned long long t = pow_clock_ns() - t0;
+        if (t < cost) cost = t;
+    }
+    if (cost > UINT32_MAX) cost = UINT32_MAX;
+    atomic_store(&search_costs[d->id], (unsigned long long)generation << 32 | cost);
+    return (unsigned)cost;
+}
+
+// Order the algorithms of a multi-algorithm search so that rejecting a nonce
+// is cheapest. Every algorithm passes a difficulty with the same probability,
+// so that is cost order, except that a digest too short for the difficulty
+// never passes and goes first.
+static void search_order(SearchPlan *plan, int num_algos, int difficulty) {
+    unsigned long long key[SEARCH_MAX_ALGOS];
+
+    for (int i = 0; i < num_algos; i++) {
+        const HashDescriptor *d = plan->descs[i];
+        key[i] = difficulty > d->digest_size * 8 ? 0 : (unsigned long long)search_cost(d, plan->generation) + 1;
+    }
+
+    // Stable insertion sort: equal keys keep the caller's order
+    for (int i = 0; i < num_algos; i++) plan->order[i] = i;
+    for (int i = 1; i < num_algos; i++) {
+        int v = plan->order[i], j = i;
+        while (j > 0 && key[plan->order[j - 1]] > key[v]) {
+            plan->order[j] = plan->order[j - 1];
+            j--;
+        }
+        plan->order[j] = v;
+    }
+}
+
+static void plan_free(SearchPlan *plan) {
+    free(plan->descs);
+    free(plan->mid);
+    free(plan->order);
+    plan->descs = NULL;
+    plan->mid = NULL;
+    plan->order = NULL;
+}
+
+// Resolve the algorithms, absorb the challenge and order them; 0 on invalid
+// algorithms or out of memory (the plan is left empty)
+static int plan_build(SearchPlan *plan, const uint8_t *input, size_t len, const HashAlgorithm *algos,
+                      int num_algos, int difficulty) {
+    size_t n = (size_t)num_algos;
+    plan->descs = (const HashDescriptor **)malloc(n * sizeof(*plan->descs));
+    plan->mid = (HashState *)malloc(n * sizeof(HashState));
+    plan->order = (int *)malloc(n * sizeof(int));
+    if (!plan->descs || !plan->mid || !plan->order) {
+        plan_free(plan);
+        return 0;
+    }
+
+    for (int i = 0; i < num_algos; i++) {
+        plan->descs[i] = hash_descriptor(algos[i]);
+        if (!plan->descs[i]) {
+            plan_free(plan);
+            return 0;
         }
+        plan->order[i] = i;
     }
-    
+    plan->generation = hash_registry_generation();
+
+    // The challenge prefix is the same for every nonce: absorb it once, into
+    // all the algorithms in one pass over it
+    hash_midstates(plan->descs, plan->mid, num_algos, input, len);
+    if (num_algos > 1) search_order(plan, num_algos, difficulty);
+    return 1;
+}
+
+static void search_release(SearchJob *job) {
+    plan_free(&job->own);
+    free(job->hashes);
+    free(job->hash_sizes);
+    job->descs = NULL;
+    job->mid = NULL;
+    job->order = NULL;
+    job->hashes = NULL;
+    job->hash_sizes = NULL;
+}
+
+// Copy the first `max` digests of the solution (zeroing the rest) and release the job
+static void search_collect(SearchJob *job, uint8_t hashes[][128], int *hash_sizes, int max) {
+    int n = job->num_algos < max ? job->num_algos : max;
+    memset(hashes, 0, (size_t)max * 128);
+    memset(hash_sizes, 0, (size_t)max * sizeof(int));
+    if (job->hashes) {
+        for (int i = 0; i < n; i++) {
+            memcpy(hashes[i], job->hashes[i], 128);
+            hash_sizes[i] = job->hash_sizes[i];
+        }
+    }
+    search_release(job);
+}
+
+// Run a search over [min_nonce, max_nonce]; returns the solution or SEARCH_NONE.
+// With a target, digests must be <= target and difficulty is ignored. plan,
+// if given, must have been built for the same challenge, algorithms and
+// difficulty and is left to the caller; otherwise one is built. The caller
+// frees the job's arrays with search_release (or search_collect).
+static long long run_search(SearchJob *job, const uint8_t *input, size_t len, const HashAlgorithm *algos,
+                            int num_algos, int difficulty, const uint8_t *target, long long min_nonce,
+                            long long max_nonce, int threads, int lowest, atomic_int *pause,
+                            const SearchPlan *plan) {
+    job->input = input;
+    job->len = len;
+    job->descs = NULL;
+    job->mid = NULL;
+    job->order = NULL;
+    memset(&job->own, 0, sizeof(job->own));
+    job->hashes = NULL;
+    job->hash_sizes = NULL;
+    job->num_algos = num_algos;
+    job->difficulty = target ? pow_target_zero_bits(target) : difficulty;
+    job->use_target = target != NULL;
+    if (target) memcpy(job->target, target, POW_TARGET_BYTES);
+    job->min_nonce = min_nonce;
+    job->max_nonce = max_nonce;
+    job->chunks = min_nonce <= max_nonce
+                ? ((unsigned long long)max_nonce - (unsigned long long)min_nonce) / SEARCH_CHUNK + 1 : 0;
+    job->lowest = lowest;
+    job->pause = pause;
+    atomic_init(&job->next, 0);
+    atomic_init(&job->best, SEARCH_NONE);
+
+    if ((!input && len) || min_nonce > max_nonce || max_nonce > SEARCH_NONCE_MAX) return SEARCH_NONE;
+    if (!algos || num_algos < 1 || num_algos > SEARCH_MAX_ALGOS) return SEARCH_NONE;
+
+    size_t n = (size_t)num_algos;
+    job->hashes = (uint8_t (*)[128])calloc(n, 128);
+    job->hash_sizes = (int *)calloc(n, sizeof(int));
+    if (!job->hashes || !job->hash_sizes) return SEARCH_NONE;
+
+    if (!plan) {
+        if (!plan_build(&job->own, input, len, algos, num_algos, job->difficulty)) return SEARCH_NONE;
+        plan = &job->own;
+    }
+    job->descs = (const HashDescriptor *const *)plan->descs;
+    job->mid = plan->mid;
+    job->order = plan->order;
+
+    // Never start more workers than there are chunks to hand out
+    threads = pow_resolve_threads(threads);
+    if ((unsigned long long)threads > job->chunks) threads = (int)job->chunks;
+
+    SearchWorker workers[POW_MAX_THREADS];
+    uint8_t (*scratch)[128] = (uint8_t (*)[128])malloc((size_t)threads * n * 128);
+    int *scratch_sizes = (int *)malloc((size_t)threads * n * sizeof(int));
+    if (!scratch || !scratch_sizes) {
+        free(scratch);
+        free(scratch_sizes);
+        return SEARCH_NONE;
+    }
+    for (int i = 0; i < threads; i++) {
+        workers[i].job = job;
+        workers[i].hashes = scratch + (size_t)i * n;
+        workers[i].sizes = scratch_sizes + (size_t)i * n;
+    }
+
+    pow_mutex_init(&job->lock);
+    pow_run_parallel(search_worker, workers, sizeof(workers[0]), threads);
+    pow_mutex_destroy(&job->lock);
+
+    free(scratch);
+    free(scratch_sizes);
+    return atomic_load(&job->best);
+}
+
+static PoWResult64 search_single(const uint8_t *input, size_t len, HashAlgorithm algo, int difficulty,
+                                 int64_t min_nonce, int64_t max_nonce, int threads, int lowest) {
+    PoWResult64 result;
+    SearchJob job;
+
+    long long nonce = run_search(&job, input, len, &algo, 1, difficulty, NULL, min_nonce, max_nonce, threads, lowest, NULL, NULL);
+    result.nonce = nonce == SEARCH_NONE ? -1 : nonce;
+    search_collect(&job, (uint8_t (*)[128])result.hash, &result.hash_size, 1);
     return result;
 }
 
+static MultiPoWResult64 search_multi(const uint8_t *input, size_t len, const HashAlgorithm *algos, int num_algos,
+                                     int difficulty, const uint8_t *target, int64_t min_nonce, int64_t max_nonce,
+                                     int threads, int lowest) {
+    MultiPoWResult64 result;
+    SearchJob job;
+
+    long long nonce = run_search(&job, input, len, algos, num_algos, difficulty, target, min_nonce, max_nonce, threads,
+                                 lowest, NULL, NULL);
+    result.nonce = nonce == SEARCH_NONE ? -1 : nonce;
+    result.num_hashes = num_algos < 0 ? 0 : num_algos < RESULT_MAX_HASHES ? num_algos : RESULT_MAX_HASHES;
+    search_collect(&job, result.hashes, result.hash_sizes, RESULT_MAX_HASHES);
+    return result;
+}
+
+static PoWResult to_result32(PoWResult64 r) {
+    PoWResult result;
+    result.nonce = (int)r.nonce;
+    memcpy(result.hash, r.hash, sizeof(result.hash));
+    result.hash_size = r.hash_size;
+    return result;
+}
+
+static MultiPoWResult to_multi_result32(MultiPoWResult64 r) {
+    MultiPoWResult result;
+    result.nonce = (int)r.nonce;
+    memcpy(result.hashes, r.hashes, sizeof(result.hashes));
+    memcpy(result.hash_sizes, r.hash_sizes, sizeof(result.hash_sizes));
+    result.num_hashes = r.num_hashes;
+    return result;
+}
+
+// Generate PoW for a single hash algorithm
+EXPORT PoWResult generate_pow_single(const char *input, HashAlgorithm algo, int difficulty, int min_nonce, int max_nonce) {
+    return to_result32(search_single((const uint8_t *)input, strlen(input), algo, difficulty, min_nonce, max_nonce, 1, 1));
+}
+
+// Generate PoW for multiple hash algorithms (all must pass)
+EXPORT MultiPoWResult generate_pow_multi(const char *input, HashAlgorithm *algos, int num_algos, int difficulty, int min_nonce, int max_nonce) {
+    return to_multi_result32(search_multi((const uint8_t *)input, strlen(input), algos, num_algos, difficulty, NULL, min_nonce, max_nonce, 1, 1));
+}
+
+// Generate PoW for a single hash algorithm on a pool of worker threads.
+// threads <= 0 uses one thread per CPU. With lowest != 0 the result is the
+// same nonce generate_pow_single would return; otherwise the first solution
+// any worker finds wins and the search stops immediately.
+EXPORT PoWResult generate_pow_single_mt(const char *input, HashAlgorithm algo, int difficulty, int min_nonce, int max_nonce, int threads, int lowest) {
+    return to_result32(search_single((const uint8_t *)input, strlen(input), algo, difficulty, min_nonce, max_nonce, threads, lowest));
+}
+
+// Multi-threaded generate_pow_multi (see generate_pow_single_mt)
+EXPORT MultiPoWResult generate_pow_multi_mt(const char *input, HashAlgorithm *algos, int num_algos, int difficulty, int min_nonce, int max_nonce, int threads, int lowest) {
+    return to_multi_result32(search_multi((const uint8_t *)input, strlen(input), algos, num_algos, difficulty, NULL, min_nonce, max_nonce, threads, lowest));
+}
+
+// 64-bit nonce search (see generate_pow_single_mt); nonce is -1 if none found.
+// Any range with max_nonce <= INT64_MAX - 1 is searched in full; a larger
+// max_nonce is rejected without searching (nonce -1).
+EXPORT PoWResult64 generate_pow_single64(const char *input, HashAlgorithm algo, int difficulty, int64_t min_nonce, int64_t max_nonce, int threads, int lowest) {
+    return search_single((const uint8_t *)input, strlen(input), algo, difficulty, min_nonce, max_nonce, threads, lowest);
+}
+
+// 64-bit nonce multi-hash search (see generate_pow_multi_mt)
+EXPORT MultiPoWResult64 generate_pow_multi64(const char *input, HashAlgorithm *algos, int num_algos, int difficulty, int64_t min_nonce, int64_t max_nonce, int threads, int lowest) {
+    return search_multi((const uint8_t *)input, strlen(input), algos, num_algos, difficulty, NULL, min_nonce, max_nonce, threads, lowest);
+}
+
+// generate_pow_single64 over a length-delimited challenge: data is hashed in
+// place, may contain NUL bytes and has no size limit
+EXPORT PoWResult64 generate_pow_single_buf(const uint8_t *data, size_t len, HashAlgorithm algo, int difficulty, int64_t min_nonce, int64_t max_nonce, int threads, int lowest) {
+    return search_single(data, len, algo, difficulty, min_nonce, max_nonce, threads, lowest);
+}
+
+// generate_pow_multi64 over a length-delimited challenge
+EXPORT MultiPoWResult64 generate_pow_multi_buf(const uint8_t *data, size_t len, HashAlgorithm *algos, int num_algos, int difficulty, int64_t min_nonce, int64_t max_nonce, int threads, int lowest) {
+    return search_multi(data, len, algos, num_algos, difficulty, NULL, min_nonce, max_nonce, threads, lowest);
+}
+
+// Target-based search: every digest of data || nonce, read as a big-endian
+// number, must be <= target (32 bytes, see pow_work_target). Otherwise as
+// generate_pow_multi_buf.
+EXPORT MultiPoWResult64 generate_pow_target(const uint8_t *data, size_t len, HashAlgorithm *algos, int num_algos, const uint8_t *target, int64_t min_nonce, int64_t max_nonce, int threads, int lowest) {
+    if (!target) {
+        MultiPoWResult64 result;
+        memset(&result, 0, sizeof(result));
+        result.nonce = -1;
+        return result;
+    }
+    return search_multi(data, len, algos, num_algos, 0, target, min_nonce, max_nonce, threads, lowest);
+}
+
+// Target for an expected number of attempts per algorithm (>= 1, need not
+// be a power of two): writes 32 bytes, returns 0 if work is invalid
+EXPORT int pow_work_target(double work, uint8_t *target) {
+    return target ? pow_target_from_work(work, target) : 0;
+}
+
+/*
+ * Resumable search cursor
+ *
+ * A cursor owns a copy of the challenge and remembers the next nonce that
+ * has not been searched yet. pow_cursor_run() searches a budget of nonces
+ * from there in lowest-nonce order, so the outcome of a search does not
+ * depend on how it was split into runs, threads or processes. The state
+ * can be saved to a byte buffer and loaded again elsewhere. A cursor takes
+ * up to SEARCH_MAX_ALGOS algorithms, like the other search entry points.
+ */
+
+#define POW_CURSOR_FOUND      1     // solution written to result, cursor moved past it
+#define POW_CURSOR_PAUSED     0     // budget spent or paused; run again to continue
+#define POW_CURSOR_EXHAUSTED -1     // whole range searched
+#define POW_CURSOR_ERROR     -2
+
+// Saved layout: magic, difficulty, algorithm count, one byte per algorithm,
+// min, max and next nonce, challenge length, challenge. Version 1 padded the
+// algorithm list to 10 bytes and is still loaded.
+#define POW_CURSOR_MAGIC     "PWC2"
+#define POW_CURSOR_MAGIC_V1  "PWC1"
+#define POW_CURSOR_HEADER(n) (4 + 4 + 4 + (size_t)(n) + 8 * 3 + 4)
+
+typedef struct PowCursor {
+    uint8_t *input;
+    size_t len;
+    HashAlgorithm algos[SEARCH_MAX_ALGOS];
+    int num_algos;
+    int difficulty;
+    int64_t min_nonce;
+    int64_t max_nonce;
+    int64_t next;                   // first nonce not searched yet
+    atomic_int pause;
+    SearchPlan plan;                // built on the first run, kept across runs
+} PowCursor;
+
+static PowCursor *cursor_new(const uint8_t *input, size_t len, const HashAlgorithm *algos, int num_algos,
+                             int difficulty, int64_t min_nonce, int64_t max_nonce, int64_t next) {
+    // The saved form records the challenge length in 32 bits
+    if ((!input && len) || !algos || num_algos < 1 || num_algos > SEARCH_MAX_ALGOS || len > UINT32_MAX) return NULL;
+    if (max_nonce > SEARCH_NONCE_MAX || min_nonce > max_nonce || next < min_nonce || next > max_nonce + 1) return NULL;
+    for (int i = 0; i < num_algos; i++) {
+        if (!hash_descriptor(algos[i])) return NULL;
+    }
+
+    PowCursor *c = (PowCursor *)calloc(1, sizeof(PowCursor));
+    if (!c) return NULL;
+    c->input = (uint8_t *)malloc(len ? len : 1);
+    if (!c->input) {
+        free(c);
+        return NULL;
+    }
+    if (len) memcpy(c->input, input, len);
+    c->len = len;
+    memcpy(c->algos, algos, num_algos * sizeof(HashAlgorithm));
+    c->num_algos = num_algos;
+    c->difficulty = difficulty;
+    c->min_nonce = min_nonce;
+    c->max_nonce = max_nonce;
+    c->next = next;
+    atomic_init(&c->pause, 0);
+    return c;
+}
+
+// Create a cursor over [min_nonce, max_nonce]; NULL on invalid arguments,
+// including max_nonce = INT64_MAX (see SEARCH_NONCE_MAX)
+EXPORT PowCursor *pow_cursor_create(const char *input, HashAlgorithm *algos, int num_algos, int difficulty, int64_t min_nonce, int64_t max_nonce) {
+    if (!input) return NULL;
+    return cursor_new((const uint8_t *)input, strlen(input), algos, num_algos, difficulty, min_nonce, max_nonce, min_nonce);
+}
+
+// pow_cursor_create over a length-delimited challenge (copied into the cursor)
+EXPORT PowCursor *pow_cursor_create_buf(const uint8_t *data, size_t len, HashAlgorithm *algos, int num_algos, int difficulty, int64_t min_nonce, int64_t max_nonce) {
+    return cursor_new(data, len, algos, num_algos, difficulty, min_nonce, max_nonce, min_nonce);
+}
+
+EXPORT void pow_cursor_free(PowCursor *cursor) {
+    if (!cursor) return;
+    plan_free(&cursor->plan);
+    free(cursor->input);
+    free(cursor);
+}
+
+// Search up to `budget` nonces (<= 0: the rest of the range) on `threads`
+// workers. Returns one of the POW_CURSOR_* codes.
+EXPORT int pow_cursor_run(PowCursor *cursor, int64_t budget, int threads, MultiPoWResult64 *result) {
+    if (!cursor || !result) return POW_CURSOR_ERROR;
+    if (cursor->next > cursor->max_nonce) return POW_CURSOR_EXHAUSTED;
+
+    int64_t end = cursor->max_nonce;
+    if (budget > 0 && (uint64_t)(budget - 1) < (uint64_t)end - (uint64_t)cursor->next) {
+        end = cursor->next + budget - 1;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->nonce = -1;
+    result->num_hashes = cursor->num_algos < RESULT_MAX_HASHES ? cursor->num_algos : RESULT_MAX_HASHES;
+
+    // Absorb the challenge and order the algorithms once per cursor, not per
+    // run; again only if the backends have been reselected since
+    if (!cursor->plan.descs || cursor->plan.generation != hash_registry_generation()) {
+        plan_free(&cursor->plan);
+        if (!plan_build(&cursor->plan, cursor->input, cursor->len, cursor->algos, cursor->num_algos,
+                        cursor->difficulty)) return POW_CURSOR_ERROR;
+    }
+
+    SearchJob job;
+    int64_t found = run_search(&job, cursor->input, cursor->len, cursor->algos, cursor->num_algos,
+                               cursor->difficulty, NULL, cursor->next, end, threads, 1, &cursor->pause,
+                               &cursor->plan);
+    int paused = atomic_exchange(&cursor->pause, 0);
+
+    if (found != SEARCH_NONE) {
+        result->nonce = found;
+        search_collect(&job, result->hashes, result->hash_sizes, RESULT_MAX_HASHES);
+        cursor->next = found + 1;
+        return POW_CURSOR_FOUND;
+    }
+    search_release(&job);
+
+    // Without a solution every claimed chunk was searched to the end
+    unsigned long long claimed = atomic_load(&job.next);
+    if (claimed >= job.chunks) cursor->next = end + 1;
+    else cursor->next = (int64_t)((uint64_t)cursor->next + claimed * SEARCH_CHUNK);
+    if (paused || cursor->next <= cursor->max_nonce) return POW_CURSOR_PAUSED;
+    return POW_CURSOR_EXHAUSTED;
+}
+
+// Ask a pow_cursor_run() in progress (on another thread) to return early.
+// Workers finish the chunk they are on; no searched nonce is lost.
+EXPORT void pow_cursor_pause(PowCursor *cursor) {
+    if (cursor) atomic_store(&cursor->pause, 1);
+}
+
+// First nonce that has not been searched yet
+EXPORT int64_t pow_cursor_position(const PowCursor *cursor) {
+    return cursor ? cursor->next : -1;
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static void put_u64(uint8_t *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)p[i] << (8 * i);
+    return v;
+}
+
+static uint64_t get_u64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+// Serialize the cursor into buf (little-endian, portable across platforms).
+// Returns the number of bytes needed; nothing is written if cap is too small.
+EXPORT size_t pow_cursor_save(const PowCursor *cursor, uint8_t *buf, size_t cap) {
+    if (!cursor) return 0;
+    size_t need = POW_CURSOR_HEADER(cursor->num_algos) + cursor->len;
+    if (!buf || cap < need) return need;
+
+    uint8_t *p = buf;
+    memcpy(p, POW_CURSOR_MAGIC, 4);                       p += 4;
+    put_u32(p, (uint32_t)cursor->difficulty);             p += 4;
+    put_u32(p, (uint32_t)cursor->num_algos);              p += 4;
+    for (int i = 0; i < cursor->num_algos; i++) p[i] = (uint8_t)cursor->algos[i];
+    p += cursor->num_algos;
+    put_u64(p, (uint64_t)cursor->min_nonce);              p += 8;
+    put_u64(p, (uint64_t)cursor->max_nonce);              p += 8;
+    put_u64(p, (uint64_t)cursor->next);                   p += 8;
+    put_u32(p, (uint32_t)cursor->len);                    p += 4;
+    memcpy(p, cursor->input, cursor->len);
+    return need;
+}
+
+// Rebuild a cursor saved by pow_cursor_save; NULL if the data is malformed
+EXPORT PowCursor *pow_cursor_load(const uint8_t *buf, size_t len) {
+    HashAlgorithm algos[SEARCH_MAX_ALGOS];
+
+    if (!buf || len < POW_CURSOR_HEADER(1)) return NULL;
+    int v1 = memcmp(buf, POW_CURSOR_MAGIC_V1, 4) == 0;
+    if (!v1 && memcmp(buf, POW_CURSOR_MAGIC, 4) != 0) return NULL;
+
+    const uint8_t *p = buf + 4;
+    int difficulty = (int)get_u32(p);                     p += 4;
+    uint32_t num_algos = get_u32(p);                      p += 4;
+    if (num_algos < 1 || num_algos > (v1 ? 10u : SEARCH_MAX_ALGOS)) return NULL;
+    size_t header = POW_CURSOR_HEADER(v1 ? 10 : num_algos);
+    if (len < header) return NULL;
+    for (uint32_t i = 0; i < num_algos; i++) algos[i] = (HashAlgorithm)p[i];
+    p += header - POW_CURSOR_HEADER(0);
+    int64_t min_nonce = (int64_t)get_u64(p);              p += 8;
+    int64_t max_nonce = (int64_t)get_u64(p);              p += 8;
+    int64_t next = (int64_t)get_u64(p);                   p += 8;
+    uint32_t input_len = get_u32(p);                      p += 4;
+    if (input_len != len - header) return NULL;
+
+    return cursor_new(p, input_len, algos, (int)num_algos, difficulty, min_nonce, max_nonce, next);
+}
+
 // Get hash algorithm by name
 EXPORT int get_hash_algo_by_name(const char *name) {
-    if (strcmp(name, "MD4") == 0) return HASH_MD4;
-    if (strcmp(name, "NT") == 0) return HASH_NT;
-    if (strcmp(name, "MD5") == 0) return HASH_MD5;
-    if (strcmp(name, "HAS-160") == 0) return HASH_HAS160;
-    if (strcmp(name, "RIPEMD-256") == 0) return HASH_RIPEMD256;
-    if (strcmp(name, "RIPEMD-128") == 0) return HASH_RIPEMD128;
-    if (strcmp(name, "BLAKE2s-128") == 0) return HASH_BLAKE2S_128;
-    if (strcmp(name, "BLAKE2s-160") == 0) return HASH_BLAKE2S_160;
-    if (strcmp(name, "BLAKE2s-256") == 0) return HASH_BLAKE2S_256;
-    if (strcmp(name, "BLAKE2b-512") == 0) return HASH_BLAKE2B_512;
-    if (strcmp(name, "RIPEMD-320") == 0) return HASH_RIPEMD320;
-    if (strcmp(name, "BLAKE2b-128") == 0) return HASH_BLAKE2B_128;
-    if (strcmp(name, "BLAKE2b-384") == 0) return HASH_BLAKE2B_384;
-    if (strcmp(name, "RIPEMD-160") == 0) return HASH_RIPEMD160;
-    if (strcmp(name, "BLAKE2b-160") == 0) return HASH_BLAKE2B_160;
-    if (strcmp(name, "BLAKE2b-256") == 0) return HASH_BLAKE2B_256;
-    if (strcmp(name, "SHA2-256") == 0 || strcmp(name, "SHA256") == 0) return HASH_SHA256;
-    if (strcmp(name, "SHA-0") == 0) return HASH_SHA0;
-    if (strcmp(name, "SHA-1") == 0 || strcmp(name, "SHA1") == 0) return HASH_SHA1;
-    if (strcmp(name, "SHA2-224") == 0) return HASH_SHA224;
-    if (strcmp(name, "SHA2-512") == 0) return HASH_SHA512;
-    if (strcmp(name, "SHA2-384") == 0) return HASH_SHA384;
-    if (strcmp(name, "Whirlpool") == 0) return HASH_WHIRLPOOL;
-    if (strcmp(name, "SHA3-224") == 0) return HASH_SHA3_224;
-    if (strcmp(name, "SHAKE-256") == 0) return HASH_SHAKE256;
-    if (strcmp(name, "SHA3-384") == 0) return HASH_SHA3_384;
-    if (strcmp(name, "SHAKE-128") == 0) return HASH_SHAKE128;
-    if (strcmp(name, "Keccak-384") == 0) return HASH_KECCAK384;
-    if (strcmp(name, "Keccak-256") == 0) return HASH_KECCAK256;
-    if (strcmp(name, "SHA3-256") == 0) return HASH_SHA3_256;
-    if (strcmp(name, "SHA3-512") == 0) return HASH_SHA3_512;
-    if (strcmp(name, "Keccak-512") == 0) return HASH_KECCAK512;
-    if (strcmp(name, "Keccak-224") == 0) return HASH_KECCAK224;
-    if (strcmp(name, "MD2") == 0) return HASH_MD2;
-    return -1;
+    return hash_algo_by_name(name);
+}
+
+// Runtime CPU dispatch: features in use (see crypto/cpu/cpu_features.h)
+EXPORT uint32_t pow_cpu_features(void) {
+    return cpu_features();
+}
+
+// Restrict the CPU features kernels may use and reselect backends; pass
+// 0xFFFFFFFF to undo, 0 for the portable code. Not while a search runs.
+EXPORT uint32_t pow_force_cpu_features(uint32_t mask) {
+    return hash_registry_force(mask);
+}
+
+// Name of the implementation selected for algo ("scalar", "sha-ni", ...)
+EXPORT const char *pow_hash_backend(HashAlgorithm algo) {
+    const HashDescriptor *d = hash_descriptor(algo);
+    return d ? d->backend : NULL;
 }
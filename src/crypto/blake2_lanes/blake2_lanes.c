@@ -0,0 +1,159 @@
+/*
+ * Multi-lane BLAKE2b / BLAKE2s kernels - shared lane loader and the per-ISA
+ * instantiations of blake2_lanes_tmpl.h
+ */
+
+#include "blake2_lanes.h"
+#include "../cpu/cpu_features.h"
+#include <string.h>
+
+#if defined(CPU_X86_KERNELS) || defined(CPU_ARM64_KERNELS)
+
+/* Final blocks of a lane group: shared words plus the words that differ */
+typedef struct {
+    int nblocks;            /* 1 or 2 */
+    int first, last;        /* words [first, last] come from the tails */
+    uint64_t base[32];      /* every other word, the same in all lanes */
+    uint64_t count[2];      /* bytes added to the counter by block 0 and 1 */
+} Blake2LanesLayout;
+
+#define BLAKE2_LANES_VAR_WORDS 9    /* a 32-byte tail spans at most 9 32-bit words */
+
+static inline uint64_t b2l_load(const uint8_t *p, size_t word_bytes) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < word_bytes; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+/*
+ * Lay out the final blocks of `lanes` messages that continue a midstate
+ * (buf holding the buflen bytes not compressed yet) with equally long
+ * tails. BLAKE2 compresses a block only once more input follows, so the
+ * buffer may be full and the tail may spill into a second block. Words are
+ * word_bytes wide (8 for BLAKE2b, 4 for BLAKE2s) and little-endian. Shared
+ * words go to lay->base; the tail words are sliced by lane into `var`, an
+ * array of the kernel's word type, var[(t - first) * lanes + lane].
+ */
+static void blake2_lanes_blocks(const uint8_t *buf, size_t buflen, size_t block_bytes, size_t word_bytes,
+                                const uint8_t *const *tails, size_t tail_len, int lanes, Blake2LanesLayout *lay,
+                                void *var) {
+    uint8_t block[256];
+    size_t used = buflen + tail_len;
+    size_t end = used > block_bytes ? 2 * block_bytes : block_bytes;
+
+    memcpy(block, buf, buflen);
+    memset(block + buflen, 0, end - buflen);
+
+    lay->nblocks = (int)(end / block_bytes);
+    lay->count[0] = lay->nblocks == 2 ? block_bytes : used;
+    lay->count[1] = used;
+    lay->first = (int)(buflen / word_bytes);
+    lay->last = tail_len ? (int)((used - 1) / word_bytes) : lay->first - 1;
+    for (size_t t = 0; t < end / word_bytes; t++) lay->base[t] = b2l_load(block + word_bytes * t, word_bytes);
+
+    for (int lane = 0; lane < lanes; lane++) {
+        memcpy(block + buflen, tails[lane], tail_len);
+        for (int t = lay->first; t <= lay->last; t++) {
+            uint64_t v = b2l_load(block + word_bytes * t, word_bytes);
+            size_t i = (size_t)(t - lay->first) * lanes + lane;
+            if (word_bytes == 8) ((uint64_t *)var)[i] = v;
+            else ((uint32_t *)var)[i] = (uint32_t)v;
+        }
+    }
+}
+
+#define B2L_ROTR(x, n, bits) (((x) >> (n)) | ((x) << ((bits) - (n))))
+
+#endif
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+// BLAKE2b, 4 x 64-bit with AVX2: byte-multiple rotations are shuffles
+#define B2L_B 1
+#define B2L_LANES 4
+#define B2L_ATTR __attribute__((target("avx2")))
+#define B2L_NAME(name) blake2b_##name##_x4_avx2
+#define B2L_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64((__m256i)(v), _mm256_setzero_si256()))))
+#define B2L_ROTR1(x) ((V)_mm256_shuffle_epi32((__m256i)(x), _MM_SHUFFLE(2, 3, 0, 1)))
+#define B2L_ROTR2(x) ((V)_mm256_shuffle_epi8((__m256i)(x), _mm256_setr_epi8(                            \
+                         3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,                            \
+                         3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10)))
+#define B2L_ROTR3(x) ((V)_mm256_shuffle_epi8((__m256i)(x), _mm256_setr_epi8(                            \
+                         2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,                            \
+                         2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9)))
+#define B2L_ROTR4(x) (((x) >> 63) ^ ((x) + (x)))
+#include "blake2_lanes_tmpl.h"
+
+// BLAKE2b, 8 x 64-bit with AVX-512F: native rotates
+#define B2L_B 1
+#define B2L_LANES 8
+#define B2L_ATTR __attribute__((target("avx512f")))
+#define B2L_NAME(name) blake2b_##name##_x8_avx512
+#define B2L_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm512_cmpeq_epi64_mask((__m512i)(v), _mm512_setzero_si512()))
+#define B2L_ROTR1(x) ((V)_mm512_ror_epi64((__m512i)(x), 32))
+#define B2L_ROTR2(x) ((V)_mm512_ror_epi64((__m512i)(x), 24))
+#define B2L_ROTR3(x) ((V)_mm512_ror_epi64((__m512i)(x), 16))
+#define B2L_ROTR4(x) ((V)_mm512_ror_epi64((__m512i)(x), 63))
+#include "blake2_lanes_tmpl.h"
+
+// BLAKE2s, 4 x 32-bit with SSE2: rotate by 16 swaps the halfwords
+#define B2L_B 0
+#define B2L_LANES 4
+#define B2L_ATTR __attribute__((target("sse2")))
+#define B2L_NAME(name) blake2s_##name##_x4_sse2
+#define B2L_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32((__m128i)(v), _mm_setzero_si128()))))
+#define B2L_ROTR1(x) ((V)_mm_shufflehi_epi16(_mm_shufflelo_epi16((__m128i)(x), 0xB1), 0xB1))
+#define B2L_ROTR2(x) B2L_ROTR(x, 12, 32)
+#define B2L_ROTR3(x) B2L_ROTR(x, 8, 32)
+#define B2L_ROTR4(x) B2L_ROTR(x, 7, 32)
+#include "blake2_lanes_tmpl.h"
+
+// BLAKE2s, 8 x 32-bit with AVX2
+#define B2L_B 0
+#define B2L_LANES 8
+#define B2L_ATTR __attribute__((target("avx2")))
+#define B2L_NAME(name) blake2s_##name##_x8_avx2
+#define B2L_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32((__m256i)(v), _mm256_setzero_si256()))))
+#define B2L_ROTR1(x) ((V)_mm256_shuffle_epi8((__m256i)(x), _mm256_setr_epi8(                            \
+                         2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,                            \
+                         2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13)))
+#define B2L_ROTR2(x) B2L_ROTR(x, 12, 32)
+#define B2L_ROTR3(x) ((V)_mm256_shuffle_epi8((__m256i)(x), _mm256_setr_epi8(                            \
+                         1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,                            \
+                         1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12)))
+#define B2L_ROTR4(x) B2L_ROTR(x, 7, 32)
+#include "blake2_lanes_tmpl.h"
+
+// BLAKE2s, 16 x 32-bit with AVX-512F
+#define B2L_B 0
+#define B2L_LANES 16
+#define B2L_ATTR __attribute__((target("avx512f")))
+#define B2L_NAME(name) blake2s_##name##_x16_avx512
+#define B2L_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm512_cmpeq_epi32_mask((__m512i)(v), _mm512_setzero_si512()))
+#define B2L_ROTR1(x) ((V)_mm512_ror_epi32((__m512i)(x), 16))
+#define B2L_ROTR2(x) ((V)_mm512_ror_epi32((__m512i)(x), 12))
+#define B2L_ROTR3(x) ((V)_mm512_ror_epi32((__m512i)(x), 8))
+#define B2L_ROTR4(x) ((V)_mm512_ror_epi32((__m512i)(x), 7))
+#include "blake2_lanes_tmpl.h"
+
+#endif /* CPU_X86_KERNELS */
+
+#if defined(CPU_ARM64_KERNELS)
+
+#define B2L_B 0
+#define B2L_LANES 4
+#define B2L_ATTR
+#define B2L_NAME(name) blake2s_##name##_x4_neon
+#define B2L_ROTR1(x) B2L_ROTR(x, 16, 32)
+#define B2L_ROTR2(x) B2L_ROTR(x, 12, 32)
+#define B2L_ROTR3(x) B2L_ROTR(x, 8, 32)
+#define B2L_ROTR4(x) B2L_ROTR(x, 7, 32)
+#include "blake2_lanes_tmpl.h"
+
+#endif /* CPU_ARM64_KERNELS */
@@ -0,0 +1,49 @@
+#ifndef BLAKE2_LANES_H
+#define BLAKE2_LANES_H
+
+/*
+ * Multi-lane BLAKE2b / BLAKE2s kernels for nonce search and tree hashing
+ *
+ * Each call finishes 4, 8 or 16 messages at once, one per vector lane
+ * (64-bit lanes for BLAKE2b, 32-bit for BLAKE2s). The messages continue the
+ * same midstate with equally long tails (at most BLAKE2_LANES_MAX_TAIL
+ * bytes) and use the midstate's digest length, so one kernel serves every
+ * digest size. The return value is the mask of lanes whose digest has at
+ * least `difficulty` leading zero bits. Only those lanes' digests are
+ * written, to digests + mid->outlen * lane.
+ *
+ * The stripes kernels compress the BLAKE2bp / BLAKE2sp leaves side by side
+ * and have the signature of blake2bp_stripes / blake2sp_stripes.
+ *
+ * Built per ISA from blake2_lanes_tmpl.h: SSE2/AVX2/AVX-512F on x86
+ * (CPU_X86_KERNELS), NEON on AArch64 (CPU_ARM64_KERNELS).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../blake2b/blake2b.h"
+#include "../blake2s/blake2s.h"
+#include "../blake2bp/blake2bp.h"
+#include "../blake2sp/blake2sp.h"
+
+#define BLAKE2_LANES_MAX_TAIL 32
+
+uint32_t blake2b_finish_x4_avx2(const BLAKE2B_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                int difficulty, uint8_t *digests);
+uint32_t blake2b_finish_x8_avx512(const BLAKE2B_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                  int difficulty, uint8_t *digests);
+uint32_t blake2s_finish_x4_sse2(const BLAKE2S_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                int difficulty, uint8_t *digests);
+uint32_t blake2s_finish_x8_avx2(const BLAKE2S_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                int difficulty, uint8_t *digests);
+uint32_t blake2s_finish_x16_avx512(const BLAKE2S_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                   int difficulty, uint8_t *digests);
+uint32_t blake2s_finish_x4_neon(const BLAKE2S_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                int difficulty, uint8_t *digests);
+
+void blake2b_stripes_x4_avx2(BLAKE2B_CTX *leaf, const uint8_t *in, size_t stripes);
+void blake2s_stripes_x4_sse2(BLAKE2S_CTX *leaf, const uint8_t *in, size_t stripes);
+void blake2s_stripes_x8_avx2(BLAKE2S_CTX *leaf, const uint8_t *in, size_t stripes);
+void blake2s_stripes_x4_neon(BLAKE2S_CTX *leaf, const uint8_t *in, size_t stripes);
+
+#endif /* BLAKE2_LANES_H */
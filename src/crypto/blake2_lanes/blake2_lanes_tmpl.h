@@ -0,0 +1,209 @@
+/*
+ * One ISA instantiation of the BLAKE2b / BLAKE2s lane kernels.
+ * blake2_lanes.c includes this file once per ISA and variant with B2L_B
+ * (1 for BLAKE2b, 0 for BLAKE2s), B2L_LANES, B2L_ATTR, B2L_NAME and the four
+ * G rotations B2L_ROTR1..4 defined. Instantiations no wider than the tree
+ * mode's leaf count also get the BLAKE2bp / BLAKE2sp leaf kernel. It is
+ * written with GCC/Clang vector extensions, so the same source becomes
+ * SSE2, AVX2, AVX-512 or NEON code under the function's target.
+ */
+
+#if B2L_B
+#define B2L_W uint64_t
+#define B2L_CTX BLAKE2B_CTX
+#define B2L_ROUNDS 12
+#define B2L_SIGMA blake2b_sigma
+#define B2L_IV blake2b_IV
+#define B2L_BLOCK BLAKE2B_BLOCKBYTES
+#define B2L_LEAVES BLAKE2BP_LEAVES
+#else
+#define B2L_W uint32_t
+#define B2L_CTX BLAKE2S_CTX
+#define B2L_ROUNDS 10
+#define B2L_SIGMA blake2s_sigma
+#define B2L_IV blake2s_IV
+#define B2L_BLOCK BLAKE2S_BLOCKBYTES
+#define B2L_LEAVES BLAKE2SP_LEAVES
+#endif
+
+typedef B2L_W B2L_NAME(b2l_vec) __attribute__((vector_size(B2L_LANES * sizeof(B2L_W))));
+#define V B2L_NAME(b2l_vec)
+
+#define B2L_G(a, b, c, d, x, y)         \
+    do {                                \
+        a = a + b + (x);                \
+        d = B2L_ROTR1(d ^ a);           \
+        c = c + d;                      \
+        b = B2L_ROTR2(b ^ c);           \
+        a = a + b + (y);                \
+        d = B2L_ROTR3(d ^ a);           \
+        c = c + d;                      \
+        b = B2L_ROTR4(b ^ c);           \
+    } while (0)
+
+// One compression of every lane; the counter and final flag are shared
+static inline B2L_ATTR __attribute__((always_inline))
+void B2L_NAME(compress)(V h[8], const V x[16], B2L_W t0, B2L_W t1, B2L_W f0) {
+    const V zero = {0};
+    V v0 = h[0], v1 = h[1], v2 = h[2], v3 = h[3], v4 = h[4], v5 = h[5], v6 = h[6], v7 = h[7];
+    V v8 = zero + B2L_IV[0], v9 = zero + B2L_IV[1], v10 = zero + B2L_IV[2], v11 = zero + B2L_IV[3];
+    V v12 = zero + (B2L_IV[4] ^ t0), v13 = zero + (B2L_IV[5] ^ t1);
+    V v14 = zero + (B2L_IV[6] ^ f0), v15 = zero + B2L_IV[7];
+
+    for (int r = 0; r < B2L_ROUNDS; r++) {
+        const uint8_t *s = B2L_SIGMA[r];
+        B2L_G(v0, v4, v8, v12, x[s[0]], x[s[1]]);
+        B2L_G(v1, v5, v9, v13, x[s[2]], x[s[3]]);
+        B2L_G(v2, v6, v10, v14, x[s[4]], x[s[5]]);
+        B2L_G(v3, v7, v11, v15, x[s[6]], x[s[7]]);
+        B2L_G(v0, v5, v10, v15, x[s[8]], x[s[9]]);
+        B2L_G(v1, v6, v11, v12, x[s[10]], x[s[11]]);
+        B2L_G(v2, v7, v8, v13, x[s[12]], x[s[13]]);
+        B2L_G(v3, v4, v9, v14, x[s[14]], x[s[15]]);
+    }
+
+    h[0] ^= v0 ^ v8; h[1] ^= v1 ^ v9; h[2] ^= v2 ^ v10; h[3] ^= v3 ^ v11;
+    h[4] ^= v4 ^ v12; h[5] ^= v5 ^ v13; h[6] ^= v6 ^ v14; h[7] ^= v7 ^ v15;
+}
+
+static inline B2L_ATTR __attribute__((always_inline))
+V B2L_NAME(bswap)(V x) {
+#if B2L_B
+    x = ((x & 0x00ff00ff00ff00ffULL) << 8) | ((x >> 8) & 0x00ff00ff00ff00ffULL);
+    x = ((x & 0x0000ffff0000ffffULL) << 16) | ((x >> 16) & 0x0000ffff0000ffffULL);
+    return (x << 32) | (x >> 32);
+#else
+    return (x << 24) | ((x & 0xff00) << 8) | ((x >> 8) & 0xff00) | (x >> 24);
+#endif
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits. Digest
+// bytes are the state words little-endian, so compare byte-swapped words.
+// B2L_ZERO_LANES, if defined, tests every lane with one compare.
+static inline B2L_ATTR __attribute__((always_inline))
+uint32_t B2L_NAME(zero_mask)(const V h[8], size_t outlen, int difficulty) {
+    const int bits = 8 * (int)sizeof(B2L_W);
+
+    if (difficulty <= 0) return (uint32_t)((1ull << B2L_LANES) - 1);
+    if ((size_t)difficulty > outlen * 8) return 0;
+
+    V acc = {0};
+    int whole = difficulty / bits, rest = difficulty % bits;
+    for (int i = 0; i < whole; i++) acc |= B2L_NAME(bswap)(h[i]);
+    if (rest) acc |= B2L_NAME(bswap)(h[whole]) >> (bits - rest);
+
+#ifdef B2L_ZERO_LANES
+    return B2L_ZERO_LANES(acc);
+#else
+    uint32_t mask = 0;
+    for (int lane = 0; lane < B2L_LANES; lane++) {
+        if (acc[lane] == 0) mask |= 1u << lane;
+    }
+    return mask;
+#endif
+}
+
+B2L_ATTR
+uint32_t B2L_NAME(finish)(const B2L_CTX *mid, const uint8_t *const *tails, size_t tail_len, int difficulty,
+                          uint8_t *digests) {
+    const int words = B2L_BLOCK / (int)sizeof(B2L_W);
+    B2L_W var[BLAKE2_LANES_VAR_WORDS * B2L_LANES], out[8 * B2L_LANES];
+    Blake2LanesLayout lay;
+    const V zero = {0};
+    V h[8], x[32];
+
+    blake2_lanes_blocks(mid->buf, mid->buflen, B2L_BLOCK, sizeof(B2L_W), tails, tail_len, B2L_LANES, &lay, var);
+    for (int t = 0; t < lay.nblocks * words; t++) {
+        if (t >= lay.first && t <= lay.last) memcpy(&x[t], var + (t - lay.first) * B2L_LANES, sizeof(V));
+        else x[t] = zero + (B2L_W)lay.base[t];
+    }
+    for (int i = 0; i < 8; i++) h[i] = zero + mid->h[i];
+    for (int b = 0; b < lay.nblocks; b++) {
+        B2L_W t0 = mid->t[0] + (B2L_W)lay.count[b];
+        B2L_W t1 = mid->t[1] + (t0 < mid->t[0]);
+        B2L_NAME(compress)(h, x + words * b, t0, t1, b == lay.nblocks - 1 ? (B2L_W)-1 : 0);
+    }
+
+    uint32_t mask = B2L_NAME(zero_mask)(h, mid->outlen, difficulty);
+    if (mask) {
+        memcpy(out, h, sizeof(out));
+        for (int lane = 0; lane < B2L_LANES; lane++) {
+            if (!(mask & (1u << lane))) continue;
+            uint8_t *d = digests + mid->outlen * lane;
+            for (size_t i = 0; i < mid->outlen; i++) {
+                d[i] = (uint8_t)(out[(i / sizeof(B2L_W)) * B2L_LANES + lane] >> (8 * (i % sizeof(B2L_W))));
+            }
+        }
+    }
+    return mask;
+}
+
+#if B2L_LANES <= B2L_LEAVES
+/*
+ * BLAKE2bp / BLAKE2sp leaves, B2L_LANES of them per pass. A leaf compresses
+ * a block only once the next one arrives, so the block held in each leaf
+ * buffer goes first and the last stripe is left in the buffers. The leaves
+ * advance in lockstep and share their counter. Loads assume a little-endian
+ * CPU, which x86 and AArch64 are.
+ */
+B2L_ATTR
+void B2L_NAME(stripes)(B2L_CTX *leaf, const uint8_t *in, size_t stripes) {
+    const size_t stride = B2L_LEAVES * B2L_BLOCK;
+    const size_t words = B2L_BLOCK / sizeof(B2L_W);
+    B2L_W w[16 * B2L_LANES];
+    V h[8], x[16];
+
+    if (stripes == 0) return;
+
+    for (int g = 0; g < B2L_LEAVES; g += B2L_LANES) {
+        B2L_CTX *l = leaf + g;
+        B2L_W t0 = l[0].t[0], t1 = l[0].t[1];
+
+        for (int i = 0; i < 8; i++) {
+            for (int lane = 0; lane < B2L_LANES; lane++) w[i * B2L_LANES + lane] = l[lane].h[i];
+        }
+        memcpy(h, w, sizeof(h));
+
+        for (size_t s = l[0].buflen ? 0 : 1; s < stripes; s++) {
+            for (int lane = 0; lane < B2L_LANES; lane++) {
+                const uint8_t *p = s ? in + (s - 1) * stride + (size_t)(g + lane) * B2L_BLOCK : l[lane].buf;
+                for (size_t i = 0; i < words; i++) {
+                    memcpy(&w[i * B2L_LANES + lane], p + i * sizeof(B2L_W), sizeof(B2L_W));
+                }
+            }
+            memcpy(x, w, sizeof(x));
+            t0 += B2L_BLOCK;
+            t1 += t0 < B2L_BLOCK;
+            B2L_NAME(compress)(h, x, t0, t1, 0);
+        }
+
+        memcpy(w, h, sizeof(h));
+        for (int lane = 0; lane < B2L_LANES; lane++) {
+            for (int i = 0; i < 8; i++) l[lane].h[i] = w[i * B2L_LANES + lane];
+            l[lane].t[0] = t0;
+            l[lane].t[1] = t1;
+            memcpy(l[lane].buf, in + (stripes - 1) * stride + (size_t)(g + lane) * B2L_BLOCK, B2L_BLOCK);
+            l[lane].buflen = B2L_BLOCK;
+        }
+    }
+}
+#endif
+
+#undef V
+#undef B2L_G
+#undef B2L_W
+#undef B2L_CTX
+#undef B2L_ROUNDS
+#undef B2L_SIGMA
+#undef B2L_IV
+#undef B2L_BLOCK
+#undef B2L_LEAVES
+#undef B2L_B
+#undef B2L_LANES
+#undef B2L_ATTR
+#undef B2L_NAME
+#undef B2L_ROTR1
+#undef B2L_ROTR2
+#undef B2L_ROTR3
+#undef B2L_ROTR4
+#undef B2L_ZERO_LANES
@@ -6,14 +6,14 @@
 #include "blake2b.h"
 #include <string.h>
 
-static const uint64_t blake2b_IV[8] = {
+const uint64_t blake2b_IV[8] = {
     0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
     0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
     0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
     0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
 };
 
-static const uint8_t blake2b_sigma[12][16] = {
+const uint8_t blake2b_sigma[12][16] = {
     { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15},
     {14,10, 4, 8, 9,15,13, 6, 1,12, 0, 2,11, 7, 5, 3},
     {11, 8,12, 0, 5, 2,15,13,10,14, 3, 6, 7, 1, 9, 4},
@@ -52,7 +52,7 @@ static const uint8_t blake2b_sigma[12][16] = {
     G(r, 7, v[3], v[4], v[ 9], v[14]); \
 } while(0)
 
-static void blake2b_compress(BLAKE2B_CTX *ctx, const uint8_t block[128]) {
+void blake2b_compress_generic(BLAKE2B_CTX *ctx, const uint8_t block[BLAKE2B_BLOCKBYTES]) {
     uint64_t m[16], v[16];
     int i;
 
@@ -82,13 +82,22 @@ static void blake2b_compress(BLAKE2B_CTX *ctx, const uint8_t block[128]) {
     for (i = 0; i < 8; ++i) ctx->h[i] ^= v[i] ^ v[i + 8];
 }
 
+blake2b_compress_fn blake2b_compress = blake2b_compress_generic;
+
+// Everything but buf, which is only read up to buflen
+static void blake2b_reset(BLAKE2B_CTX *ctx, size_t outlen) {
+    for (int i = 0; i < 8; ++i) ctx->h[i] = blake2b_IV[i];
+    ctx->t[0] = ctx->t[1] = 0;
+    ctx->f[0] = ctx->f[1] = 0;
+    ctx->buflen = 0;
+    ctx->outlen = outlen;
+}
+
 int blake2b_init(BLAKE2B_CTX *ctx, size_t outlen) {
     if (outlen == 0 || outlen > BLAKE2B_OUTBYTES) return -1;
 
-    memset(ctx, 0, sizeof(*ctx));
-    for (int i = 0; i < 8; ++i) ctx->h[i] = blake2b_IV[i];
+    blake2b_reset(ctx, outlen);
     ctx->h[0] ^= 0x01010000 ^ outlen;
-    ctx->outlen = outlen;
 
     return 0;
 }
@@ -97,10 +106,8 @@ int blake2b_init_key(BLAKE2B_CTX *ctx, size_t outlen, const void *key, size_t ke
     if (outlen == 0 || outlen > BLAKE2B_OUTBYTES) return -1;
     if (keylen == 0 || keylen > BLAKE2B_KEYBYTES) return -1;
 
-    memset(ctx, 0, sizeof(*ctx));
-    for (int i = 0; i < 8; ++i) ctx->h[i] = blake2b_IV[i];
+    blake2b_reset(ctx, outlen);
     ctx->h[0] ^= 0x01010000 ^ (keylen << 8) ^ outlen;
-    ctx->outlen = outlen;
 
     uint8_t block[BLAKE2B_BLOCKBYTES] = {0};
     memcpy(block, key, keylen);
@@ -110,6 +117,19 @@ int blake2b_init_key(BLAKE2B_CTX *ctx, size_t outlen, const void *key, size_t ke
     return 0;
 }
 
+int blake2b_init_node(BLAKE2B_CTX *ctx, size_t outlen, size_t fanout, size_t depth, uint64_t node_offset,
+                      size_t node_depth, size_t inner_length) {
+    if (outlen == 0 || outlen > BLAKE2B_OUTBYTES) return -1;
+    if (inner_length > BLAKE2B_OUTBYTES) return -1;
+
+    blake2b_reset(ctx, outlen);
+    ctx->h[0] ^= outlen ^ (fanout << 16) ^ (depth << 24);
+    ctx->h[1] ^= node_offset;
+    ctx->h[2] ^= node_depth ^ (inner_length << 8);
+
+    return 0;
+}
+
 int blake2b_update(BLAKE2B_CTX *ctx, const void *in, size_t inlen) {
     const uint8_t *pin = (const uint8_t *)in;
 
@@ -142,15 +162,19 @@ int blake2b_update(BLAKE2B_CTX *ctx, const void *in, size_t inlen) {
     return 0;
 }
 
-int blake2b_final(BLAKE2B_CTX *ctx, void *out, size_t outlen) {
-    if (out == NULL || outlen < ctx->outlen) return -1;
-
+void blake2b_final_state(BLAKE2B_CTX *ctx) {
     ctx->t[0] += ctx->buflen;
     if (ctx->t[0] < ctx->buflen) ctx->t[1]++;
     ctx->f[0] = (uint64_t)-1;
 
     memset(ctx->buf + ctx->buflen, 0, BLAKE2B_BLOCKBYTES - ctx->buflen);
     blake2b_compress(ctx, ctx->buf);
+}
+
+int blake2b_final(BLAKE2B_CTX *ctx, void *out, size_t outlen) {
+    if (out == NULL || outlen < ctx->outlen) return -1;
+
+    blake2b_final_state(ctx);
 
     uint8_t buffer[BLAKE2B_OUTBYTES];
     for (int i = 0; i < 8; ++i) {
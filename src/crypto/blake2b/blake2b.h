@@ -22,6 +22,19 @@ int blake2b_init_key(BLAKE2B_CTX *ctx, size_t outlen, const void *key, size_t ke
 int blake2b_update(BLAKE2B_CTX *ctx, const void *in, size_t inlen);
 int blake2b_final(BLAKE2B_CTX *ctx, void *out, size_t outlen);
 
+/* Last block only: ctx->h then holds the digest, ctx->outlen bytes of
+ * little-endian words */
+void blake2b_final_state(BLAKE2B_CTX *ctx);
+
+/*
+ * Initialize one node of a hash tree (BLAKE2 spec, section 2.10): outlen is
+ * the tree's digest length, inner_length the digest length of its inner
+ * nodes. Leaves are unlimited in length. The caller sets f[1] before the
+ * final call of the last node on each level. Used by BLAKE2bp.
+ */
+int blake2b_init_node(BLAKE2B_CTX *ctx, size_t outlen, size_t fanout, size_t depth, uint64_t node_offset,
+                      size_t node_depth, size_t inner_length);
+
 /* Convenience functions for specific output sizes */
 void blake2b_128_hash(const uint8_t *data, size_t len, uint8_t digest[16]);
 void blake2b_160_hash(const uint8_t *data, size_t len, uint8_t digest[20]);
@@ -29,4 +42,18 @@ void blake2b_256_hash(const uint8_t *data, size_t len, uint8_t digest[32]);
 void blake2b_384_hash(const uint8_t *data, size_t len, uint8_t digest[48]);
 void blake2b_512_hash(const uint8_t *data, size_t len, uint8_t digest[64]);
 
+/*
+ * Block compression used by update/final. Points at the portable
+ * blake2b_compress_generic unless the registry selects an accelerated kernel.
+ */
+typedef void (*blake2b_compress_fn)(BLAKE2B_CTX *ctx, const uint8_t block[BLAKE2B_BLOCKBYTES]);
+extern blake2b_compress_fn blake2b_compress;
+void blake2b_compress_generic(BLAKE2B_CTX *ctx, const uint8_t block[BLAKE2B_BLOCKBYTES]);
+/* Row-vectorized kernel (x86 only, blake2b/blake2b_avx2.c) */
+void blake2b_compress_avx2(BLAKE2B_CTX *ctx, const uint8_t block[BLAKE2B_BLOCKBYTES]);
+
+/* Constants, shared with the accelerated kernels */
+extern const uint64_t blake2b_IV[8];
+extern const uint8_t blake2b_sigma[12][16];
+
 #endif /* BLAKE2B_H */
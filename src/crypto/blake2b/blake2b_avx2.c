@@ -0,0 +1,85 @@
+/*
+ * BLAKE2b compression with AVX2
+ *
+ * Row-vectorized: each 256-bit register holds one row of the 4x4 state, so
+ * the four column G functions run as one vector G, and a lane rotation of
+ * rows 2-4 turns the diagonals into columns for the second half of the
+ * round. Selected at runtime by the hash registry.
+ */
+
+#include "blake2b.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define LOADU(p)  _mm256_loadu_si256((const __m256i *)(p))
+#define STOREU(p, r) _mm256_storeu_si256((__m256i *)(p), (r))
+
+// Rotations by whole bytes are byte shuffles; by 63 is add-and-shift
+#define ROTR32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR24(x) _mm256_shuffle_epi8((x), r24)
+#define ROTR16(x) _mm256_shuffle_epi8((x), r16)
+#define ROTR63(x) _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+#define G1(a, b, c, d, m)                                          \
+    do {                                                           \
+        a = _mm256_add_epi64(_mm256_add_epi64(a, b), m);           \
+        d = ROTR32(_mm256_xor_si256(d, a));                        \
+        c = _mm256_add_epi64(c, d);                                \
+        b = ROTR24(_mm256_xor_si256(b, c));                        \
+    } while (0)
+
+#define G2(a, b, c, d, m)                                          \
+    do {                                                           \
+        a = _mm256_add_epi64(_mm256_add_epi64(a, b), m);           \
+        d = ROTR16(_mm256_xor_si256(d, a));                        \
+        c = _mm256_add_epi64(c, d);                                \
+        b = ROTR63(_mm256_xor_si256(b, c));                        \
+    } while (0)
+
+// Message words of one half round, lane i taking m[s[2 * i + k]]
+#define MSG(s, k) _mm256_set_epi64x((long long)m[s[(k) + 6]], (long long)m[s[(k) + 4]], \
+                                    (long long)m[s[(k) + 2]], (long long)m[s[(k)]])
+
+__attribute__((target("avx2")))
+void blake2b_compress_avx2(BLAKE2B_CTX *ctx, const uint8_t block[BLAKE2B_BLOCKBYTES]) {
+    const __m256i r24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                         3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+    const __m256i r16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                         2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    uint64_t m[16];
+
+    for (int i = 0; i < 16; i++) {
+        const uint8_t *p = block + 8 * i;
+        m[i] = (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+               ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+    }
+
+    const __m256i h0 = LOADU(ctx->h), h1 = LOADU(ctx->h + 4);
+    __m256i a = h0, b = h1, c = LOADU(blake2b_IV);
+    __m256i d = _mm256_xor_si256(LOADU(blake2b_IV + 4),
+                                 _mm256_set_epi64x((long long)ctx->f[1], (long long)ctx->f[0],
+                                                   (long long)ctx->t[1], (long long)ctx->t[0]));
+
+    for (int r = 0; r < 12; r++) {
+        const uint8_t *s = blake2b_sigma[r];
+
+        G1(a, b, c, d, MSG(s, 0));
+        G2(a, b, c, d, MSG(s, 1));
+        // Diagonals to columns
+        b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+        c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+        G1(a, b, c, d, MSG(s, 8));
+        G2(a, b, c, d, MSG(s, 9));
+        b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+        c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    STOREU(ctx->h, _mm256_xor_si256(h0, _mm256_xor_si256(a, c)));
+    STOREU(ctx->h + 4, _mm256_xor_si256(h1, _mm256_xor_si256(b, d)));
+}
+
+#endif /* CPU_X86_KERNELS */
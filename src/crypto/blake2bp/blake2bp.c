@@ -0,0 +1,87 @@
+/*
+ * BLAKE2bp Implementation
+ * Based on the BLAKE2 reference implementation (blake2bp.c)
+ */
+
+#include "blake2bp.h"
+#include <string.h>
+
+void blake2bp_stripes_generic(BLAKE2B_CTX leaf[BLAKE2BP_LEAVES], const uint8_t *in, size_t stripes) {
+    for (; stripes; stripes--, in += BLAKE2BP_STRIPEBYTES) {
+        for (int i = 0; i < BLAKE2BP_LEAVES; ++i) {
+            blake2b_update(&leaf[i], in + i * BLAKE2B_BLOCKBYTES, BLAKE2B_BLOCKBYTES);
+        }
+    }
+}
+
+blake2bp_stripes_fn blake2bp_stripes = blake2bp_stripes_generic;
+
+int blake2bp_init(BLAKE2BP_CTX *ctx, size_t outlen) {
+    if (outlen == 0 || outlen > BLAKE2B_OUTBYTES) return -1;
+
+    for (int i = 0; i < BLAKE2BP_LEAVES; ++i) {
+        blake2b_init_node(&ctx->leaf[i], outlen, BLAKE2BP_LEAVES, 2, (uint64_t)i, 0, BLAKE2B_OUTBYTES);
+        // Leaves emit inner_length bytes whatever the tree's digest length
+        ctx->leaf[i].outlen = BLAKE2B_OUTBYTES;
+    }
+    ctx->buflen = 0;
+    ctx->outlen = outlen;
+
+    return 0;
+}
+
+int blake2bp_update(BLAKE2BP_CTX *ctx, const void *in, size_t inlen) {
+    const uint8_t *pin = (const uint8_t *)in;
+    size_t left = ctx->buflen;
+    size_t fill = BLAKE2BP_STRIPEBYTES - left;
+
+    if (left && inlen >= fill) {
+        memcpy(ctx->buf + left, pin, fill);
+        blake2bp_stripes(ctx->leaf, ctx->buf, 1);
+        pin += fill;
+        inlen -= fill;
+        left = 0;
+    }
+
+    size_t stripes = inlen / BLAKE2BP_STRIPEBYTES;
+    if (stripes) {
+        blake2bp_stripes(ctx->leaf, pin, stripes);
+        pin += stripes * BLAKE2BP_STRIPEBYTES;
+        inlen -= stripes * BLAKE2BP_STRIPEBYTES;
+    }
+
+    memcpy(ctx->buf + left, pin, inlen);
+    ctx->buflen = left + inlen;
+
+    return 0;
+}
+
+int blake2bp_final(BLAKE2BP_CTX *ctx, void *out, size_t outlen) {
+    uint8_t hash[BLAKE2BP_LEAVES][BLAKE2B_OUTBYTES];
+    BLAKE2B_CTX root;
+
+    if (out == NULL || outlen < ctx->outlen) return -1;
+
+    for (int i = 0; i < BLAKE2BP_LEAVES; ++i) {
+        size_t offset = (size_t)i * BLAKE2B_BLOCKBYTES;
+        if (ctx->buflen > offset) {
+            size_t left = ctx->buflen - offset;
+            blake2b_update(&ctx->leaf[i], ctx->buf + offset, left < BLAKE2B_BLOCKBYTES ? left : BLAKE2B_BLOCKBYTES);
+        }
+        // The last leaf and the root are the last nodes of their levels
+        if (i == BLAKE2BP_LEAVES - 1) ctx->leaf[i].f[1] = (uint64_t)-1;
+        blake2b_final(&ctx->leaf[i], hash[i], BLAKE2B_OUTBYTES);
+    }
+
+    blake2b_init_node(&root, ctx->outlen, BLAKE2BP_LEAVES, 2, 0, 1, BLAKE2B_OUTBYTES);
+    blake2b_update(&root, hash, sizeof(hash));
+    root.f[1] = (uint64_t)-1;
+    return blake2b_final(&root, out, ctx->outlen);
+}
+
+void blake2bp_512_hash(const uint8_t *data, size_t len, uint8_t digest[64]) {
+    BLAKE2BP_CTX ctx;
+    blake2bp_init(&ctx, 64);
+    blake2bp_update(&ctx, data, len);
+    blake2bp_final(&ctx, digest, 64);
+}
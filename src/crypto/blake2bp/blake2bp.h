@@ -0,0 +1,40 @@
+#ifndef BLAKE2BP_H
+#define BLAKE2BP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../blake2b/blake2b.h"
+
+#define BLAKE2BP_LEAVES 4
+#define BLAKE2BP_STRIPEBYTES (BLAKE2BP_LEAVES * BLAKE2B_BLOCKBYTES)
+
+/*
+ * BLAKE2bp: four BLAKE2b leaves under one BLAKE2b root. 128-byte block i of
+ * the message goes to leaf i mod 4, and the root hashes the four leaf
+ * digests. The leaves are independent, so they are compressed side by side
+ * in SIMD lanes where the CPU allows.
+ */
+typedef struct {
+    BLAKE2B_CTX leaf[BLAKE2BP_LEAVES];
+    uint8_t buf[BLAKE2BP_STRIPEBYTES];
+    size_t buflen;
+    size_t outlen;
+} BLAKE2BP_CTX;
+
+int blake2bp_init(BLAKE2BP_CTX *ctx, size_t outlen);
+int blake2bp_update(BLAKE2BP_CTX *ctx, const void *in, size_t inlen);
+int blake2bp_final(BLAKE2BP_CTX *ctx, void *out, size_t outlen);
+
+void blake2bp_512_hash(const uint8_t *data, size_t len, uint8_t digest[64]);
+
+/*
+ * Absorb whole stripes (one block per leaf, leaf i taking block i of each
+ * stripe) into the leaves. Same result as blake2b_update of each block into
+ * its leaf. Points at the portable blake2bp_stripes_generic unless the
+ * registry selects a multi-lane kernel (blake2_lanes/blake2_lanes.h).
+ */
+typedef void (*blake2bp_stripes_fn)(BLAKE2B_CTX leaf[BLAKE2BP_LEAVES], const uint8_t *in, size_t stripes);
+extern blake2bp_stripes_fn blake2bp_stripes;
+void blake2bp_stripes_generic(BLAKE2B_CTX leaf[BLAKE2BP_LEAVES], const uint8_t *in, size_t stripes);
+
+#endif /* BLAKE2BP_H */
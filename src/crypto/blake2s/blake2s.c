@@ -6,12 +6,12 @@
 #include "blake2s.h"
 #include <string.h>
 
-static const uint32_t blake2s_IV[8] = {
+const uint32_t blake2s_IV[8] = {
     0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
     0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL
 };
 
-static const uint8_t blake2s_sigma[10][16] = {
+const uint8_t blake2s_sigma[10][16] = {
     { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15},
     {14,10, 4, 8, 9,15,13, 6, 1,12, 0, 2,11, 7, 5, 3},
     {11, 8,12, 0, 5, 2,15,13,10,14, 3, 6, 7, 1, 9, 4},
@@ -48,7 +48,7 @@ static const uint8_t blake2s_sigma[10][16] = {
     G(r, 7, v[3], v[4], v[ 9], v[14]); \
 } while(0)
 
-static void blake2s_compress(BLAKE2S_CTX *ctx, const uint8_t block[64]) {
+void blake2s_compress_generic(BLAKE2S_CTX *ctx, const uint8_t block[BLAKE2S_BLOCKBYTES]) {
     uint32_t m[16], v[16];
     int i;
 
@@ -73,13 +73,22 @@ static void blake2s_compress(BLAKE2S_CTX *ctx, const uint8_t block[64]) {
     for (i = 0; i < 8; ++i) ctx->h[i] ^= v[i] ^ v[i + 8];
 }
 
+blake2s_compress_fn blake2s_compress = blake2s_compress_generic;
+
+// Everything but buf, which is only read up to buflen
+static void blake2s_reset(BLAKE2S_CTX *ctx, size_t outlen) {
+    for (int i = 0; i < 8; ++i) ctx->h[i] = blake2s_IV[i];
+    ctx->t[0] = ctx->t[1] = 0;
+    ctx->f[0] = ctx->f[1] = 0;
+    ctx->buflen = 0;
+    ctx->outlen = outlen;
+}
+
 int blake2s_init(BLAKE2S_CTX *ctx, size_t outlen) {
     if (outlen == 0 || outlen > BLAKE2S_OUTBYTES) return -1;
 
-    memset(ctx, 0, sizeof(*ctx));
-    for (int i = 0; i < 8; ++i) ctx->h[i] = blake2s_IV[i];
+    blake2s_reset(ctx, outlen);
     ctx->h[0] ^= 0x01010000 ^ outlen;
-    ctx->outlen = outlen;
 
     return 0;
 }
@@ -88,10 +97,8 @@ int blake2s_init_key(BLAKE2S_CTX *ctx, size_t outlen, const void *key, size_t ke
     if (outlen == 0 || outlen > BLAKE2S_OUTBYTES) return -1;
     if (keylen == 0 || keylen > BLAKE2S_KEYBYTES) return -1;
 
-    memset(ctx, 0, sizeof(*ctx));
-    for (int i = 0; i < 8; ++i) ctx->h[i] = blake2s_IV[i];
+    blake2s_reset(ctx, outlen);
     ctx->h[0] ^= 0x01010000 ^ (keylen << 8) ^ outlen;
-    ctx->outlen = outlen;
 
     uint8_t block[BLAKE2S_BLOCKBYTES] = {0};
     memcpy(block, key, keylen);
@@ -101,6 +108,19 @@ int blake2s_init_key(BLAKE2S_CTX *ctx, size_t outlen, const void *key, size_t ke
     return 0;
 }
 
+int blake2s_init_node(BLAKE2S_CTX *ctx, size_t outlen, size_t fanout, size_t depth, uint64_t node_offset,
+                      size_t node_depth, size_t inner_length) {
+    if (outlen == 0 || outlen > BLAKE2S_OUTBYTES) return -1;
+    if (inner_length > BLAKE2S_OUTBYTES) return -1;
+
+    blake2s_reset(ctx, outlen);
+    ctx->h[0] ^= (uint32_t)(outlen ^ (fanout << 16) ^ (depth << 24));
+    ctx->h[2] ^= (uint32_t)node_offset;
+    ctx->h[3] ^= (uint32_t)((node_offset >> 32) ^ (node_depth << 16) ^ (inner_length << 24));
+
+    return 0;
+}
+
 int blake2s_update(BLAKE2S_CTX *ctx, const void *in, size_t inlen) {
     const uint8_t *pin = (const uint8_t *)in;
 
@@ -133,15 +153,19 @@ int blake2s_update(BLAKE2S_CTX *ctx, const void *in, size_t inlen) {
     return 0;
 }
 
-int blake2s_final(BLAKE2S_CTX *ctx, void *out, size_t outlen) {
-    if (out == NULL || outlen < ctx->outlen) return -1;
-
+void blake2s_final_state(BLAKE2S_CTX *ctx) {
     ctx->t[0] += (uint32_t)ctx->buflen;
     if (ctx->t[0] < ctx->buflen) ctx->t[1]++;
     ctx->f[0] = (uint32_t)-1;
 
     memset(ctx->buf + ctx->buflen, 0, BLAKE2S_BLOCKBYTES - ctx->buflen);
     blake2s_compress(ctx, ctx->buf);
+}
+
+int blake2s_final(BLAKE2S_CTX *ctx, void *out, size_t outlen) {
+    if (out == NULL || outlen < ctx->outlen) return -1;
+
+    blake2s_final_state(ctx);
 
     uint8_t buffer[BLAKE2S_OUTBYTES];
     for (int i = 0; i < 8; ++i) {
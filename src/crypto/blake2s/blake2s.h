@@ -22,9 +22,36 @@ int blake2s_init_key(BLAKE2S_CTX *ctx, size_t outlen, const void *key, size_t ke
 int blake2s_update(BLAKE2S_CTX *ctx, const void *in, size_t inlen);
 int blake2s_final(BLAKE2S_CTX *ctx, void *out, size_t outlen);
 
+/* As blake2b_final_state: compress the last block, digest left in ctx->h */
+void blake2s_final_state(BLAKE2S_CTX *ctx);
+
+/*
+ * Initialize one node of a hash tree (BLAKE2 spec, section 2.10): outlen is
+ * the tree's digest length, inner_length the digest length of its inner
+ * nodes. Leaves are unlimited in length and node_offset is 48 bits. The
+ * caller sets f[1] before the final call of the last node on each level.
+ * Used by BLAKE2sp.
+ */
+int blake2s_init_node(BLAKE2S_CTX *ctx, size_t outlen, size_t fanout, size_t depth, uint64_t node_offset,
+                      size_t node_depth, size_t inner_length);
+
 /* Convenience functions for specific output sizes */
 void blake2s_128_hash(const uint8_t *data, size_t len, uint8_t digest[16]);
 void blake2s_160_hash(const uint8_t *data, size_t len, uint8_t digest[20]);
 void blake2s_256_hash(const uint8_t *data, size_t len, uint8_t digest[32]);
 
+/*
+ * Block compression used by update/final. Points at the portable
+ * blake2s_compress_generic unless the registry selects an accelerated kernel.
+ */
+typedef void (*blake2s_compress_fn)(BLAKE2S_CTX *ctx, const uint8_t block[BLAKE2S_BLOCKBYTES]);
+extern blake2s_compress_fn blake2s_compress;
+void blake2s_compress_generic(BLAKE2S_CTX *ctx, const uint8_t block[BLAKE2S_BLOCKBYTES]);
+/* Row-vectorized kernel (x86 only, blake2s/blake2s_ssse3.c) */
+void blake2s_compress_ssse3(BLAKE2S_CTX *ctx, const uint8_t block[BLAKE2S_BLOCKBYTES]);
+
+/* Constants, shared with the accelerated kernels */
+extern const uint32_t blake2s_IV[8];
+extern const uint8_t blake2s_sigma[10][16];
+
 #endif /* BLAKE2S_H */
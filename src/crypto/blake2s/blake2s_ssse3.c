@@ -0,0 +1,80 @@
+/*
+ * BLAKE2s compression with SSSE3
+ *
+ * Row-vectorized: each 128-bit register holds one row of the 4x4 state, so
+ * the four column G functions run as one vector G, and a lane rotation of
+ * rows 2-4 turns the diagonals into columns for the second half of the
+ * round. Selected at runtime by the hash registry.
+ */
+
+#include "blake2s.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define LOADU(p)  _mm_loadu_si128((const __m128i *)(p))
+#define STOREU(p, r) _mm_storeu_si128((__m128i *)(p), (r))
+
+// Rotations by whole bytes are byte shuffles
+#define ROTR16(x) _mm_shuffle_epi8((x), r16)
+#define ROTR12(x) _mm_or_si128(_mm_srli_epi32((x), 12), _mm_slli_epi32((x), 20))
+#define ROTR8(x)  _mm_shuffle_epi8((x), r8)
+#define ROTR7(x)  _mm_or_si128(_mm_srli_epi32((x), 7), _mm_slli_epi32((x), 25))
+
+#define G1(a, b, c, d, m)                                 \
+    do {                                                  \
+        a = _mm_add_epi32(_mm_add_epi32(a, b), m);        \
+        d = ROTR16(_mm_xor_si128(d, a));                  \
+        c = _mm_add_epi32(c, d);                          \
+        b = ROTR12(_mm_xor_si128(b, c));                  \
+    } while (0)
+
+#define G2(a, b, c, d, m)                                 \
+    do {                                                  \
+        a = _mm_add_epi32(_mm_add_epi32(a, b), m);        \
+        d = ROTR8(_mm_xor_si128(d, a));                   \
+        c = _mm_add_epi32(c, d);                          \
+        b = ROTR7(_mm_xor_si128(b, c));                   \
+    } while (0)
+
+// Message words of one half round, lane i taking m[s[2 * i + k]]
+#define MSG(s, k) _mm_set_epi32((int)m[s[(k) + 6]], (int)m[s[(k) + 4]], (int)m[s[(k) + 2]], (int)m[s[(k)]])
+
+__attribute__((target("ssse3")))
+void blake2s_compress_ssse3(BLAKE2S_CTX *ctx, const uint8_t block[BLAKE2S_BLOCKBYTES]) {
+    const __m128i r16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m128i r8 = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+    uint32_t m[16];
+
+    for (int i = 0; i < 16; i++) {
+        const uint8_t *p = block + 4 * i;
+        m[i] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    const __m128i h0 = LOADU(ctx->h), h1 = LOADU(ctx->h + 4);
+    __m128i a = h0, b = h1, c = LOADU(blake2s_IV);
+    __m128i d = _mm_xor_si128(LOADU(blake2s_IV + 4),
+                              _mm_set_epi32((int)ctx->f[1], (int)ctx->f[0], (int)ctx->t[1], (int)ctx->t[0]));
+
+    for (int r = 0; r < 10; r++) {
+        const uint8_t *s = blake2s_sigma[r];
+
+        G1(a, b, c, d, MSG(s, 0));
+        G2(a, b, c, d, MSG(s, 1));
+        // Diagonals to columns
+        b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1));
+        c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm_shuffle_epi32(d, _MM_SHUFFLE(2, 1, 0, 3));
+        G1(a, b, c, d, MSG(s, 8));
+        G2(a, b, c, d, MSG(s, 9));
+        b = _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3));
+        c = _mm_shuffle_epi32(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm_shuffle_epi32(d, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    STOREU(ctx->h, _mm_xor_si128(h0, _mm_xor_si128(a, c)));
+    STOREU(ctx->h + 4, _mm_xor_si128(h1, _mm_xor_si128(b, d)));
+}
+
+#endif /* CPU_X86_KERNELS */
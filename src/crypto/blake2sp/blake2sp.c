@@ -0,0 +1,87 @@
+/*
+ * BLAKE2sp Implementation
+ * Based on the BLAKE2 reference implementation (blake2sp.c)
+ */
+
+#include "blake2sp.h"
+#include <string.h>
+
+void blake2sp_stripes_generic(BLAKE2S_CTX leaf[BLAKE2SP_LEAVES], const uint8_t *in, size_t stripes) {
+    for (; stripes; stripes--, in += BLAKE2SP_STRIPEBYTES) {
+        for (int i = 0; i < BLAKE2SP_LEAVES; ++i) {
+            blake2s_update(&leaf[i], in + i * BLAKE2S_BLOCKBYTES, BLAKE2S_BLOCKBYTES);
+        }
+    }
+}
+
+blake2sp_stripes_fn blake2sp_stripes = blake2sp_stripes_generic;
+
+int blake2sp_init(BLAKE2SP_CTX *ctx, size_t outlen) {
+    if (outlen == 0 || outlen > BLAKE2S_OUTBYTES) return -1;
+
+    for (int i = 0; i < BLAKE2SP_LEAVES; ++i) {
+        blake2s_init_node(&ctx->leaf[i], outlen, BLAKE2SP_LEAVES, 2, (uint64_t)i, 0, BLAKE2S_OUTBYTES);
+        // Leaves emit inner_length bytes whatever the tree's digest length
+        ctx->leaf[i].outlen = BLAKE2S_OUTBYTES;
+    }
+    ctx->buflen = 0;
+    ctx->outlen = outlen;
+
+    return 0;
+}
+
+int blake2sp_update(BLAKE2SP_CTX *ctx, const void *in, size_t inlen) {
+    const uint8_t *pin = (const uint8_t *)in;
+    size_t left = ctx->buflen;
+    size_t fill = BLAKE2SP_STRIPEBYTES - left;
+
+    if (left && inlen >= fill) {
+        memcpy(ctx->buf + left, pin, fill);
+        blake2sp_stripes(ctx->leaf, ctx->buf, 1);
+        pin += fill;
+        inlen -= fill;
+        left = 0;
+    }
+
+    size_t stripes = inlen / BLAKE2SP_STRIPEBYTES;
+    if (stripes) {
+        blake2sp_stripes(ctx->leaf, pin, stripes);
+        pin += stripes * BLAKE2SP_STRIPEBYTES;
+        inlen -= stripes * BLAKE2SP_STRIPEBYTES;
+    }
+
+    memcpy(ctx->buf + left, pin, inlen);
+    ctx->buflen = left + inlen;
+
+    return 0;
+}
+
+int blake2sp_final(BLAKE2SP_CTX *ctx, void *out, size_t outlen) {
+    uint8_t hash[BLAKE2SP_LEAVES][BLAKE2S_OUTBYTES];
+    BLAKE2S_CTX root;
+
+    if (out == NULL || outlen < ctx->outlen) return -1;
+
+    for (int i = 0; i < BLAKE2SP_LEAVES; ++i) {
+        size_t offset = (size_t)i * BLAKE2S_BLOCKBYTES;
+        if (ctx->buflen > offset) {
+            size_t left = ctx->buflen - offset;
+            blake2s_update(&ctx->leaf[i], ctx->buf + offset, left < BLAKE2S_BLOCKBYTES ? left : BLAKE2S_BLOCKBYTES);
+        }
+        // The last leaf and the root are the last nodes of their levels
+        if (i == BLAKE2SP_LEAVES - 1) ctx->leaf[i].f[1] = (uint32_t)-1;
+        blake2s_final(&ctx->leaf[i], hash[i], BLAKE2S_OUTBYTES);
+    }
+
+    blake2s_init_node(&root, ctx->outlen, BLAKE2SP_LEAVES, 2, 0, 1, BLAKE2S_OUTBYTES);
+    blake2s_update(&root, hash, sizeof(hash));
+    root.f[1] = (uint32_t)-1;
+    return blake2s_final(&root, out, ctx->outlen);
+}
+
+void blake2sp_256_hash(const uint8_t *data, size_t len, uint8_t digest[32]) {
+    BLAKE2SP_CTX ctx;
+    blake2sp_init(&ctx, 32);
+    blake2sp_update(&ctx, data, len);
+    blake2sp_final(&ctx, digest, 32);
+}
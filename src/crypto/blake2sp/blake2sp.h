@@ -0,0 +1,40 @@
+#ifndef BLAKE2SP_H
+#define BLAKE2SP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../blake2s/blake2s.h"
+
+#define BLAKE2SP_LEAVES 8
+#define BLAKE2SP_STRIPEBYTES (BLAKE2SP_LEAVES * BLAKE2S_BLOCKBYTES)
+
+/*
+ * BLAKE2sp: eight BLAKE2s leaves under one BLAKE2s root. 64-byte block i of
+ * the message goes to leaf i mod 8, and the root hashes the eight leaf
+ * digests. The leaves are independent, so they are compressed side by side
+ * in SIMD lanes where the CPU allows.
+ */
+typedef struct {
+    BLAKE2S_CTX leaf[BLAKE2SP_LEAVES];
+    uint8_t buf[BLAKE2SP_STRIPEBYTES];
+    size_t buflen;
+    size_t outlen;
+} BLAKE2SP_CTX;
+
+int blake2sp_init(BLAKE2SP_CTX *ctx, size_t outlen);
+int blake2sp_update(BLAKE2SP_CTX *ctx, const void *in, size_t inlen);
+int blake2sp_final(BLAKE2SP_CTX *ctx, void *out, size_t outlen);
+
+void blake2sp_256_hash(const uint8_t *data, size_t len, uint8_t digest[32]);
+
+/*
+ * Absorb whole stripes (one block per leaf, leaf i taking block i of each
+ * stripe) into the leaves. Same result as blake2s_update of each block into
+ * its leaf. Points at the portable blake2sp_stripes_generic unless the
+ * registry selects a multi-lane kernel (blake2_lanes/blake2_lanes.h).
+ */
+typedef void (*blake2sp_stripes_fn)(BLAKE2S_CTX leaf[BLAKE2SP_LEAVES], const uint8_t *in, size_t stripes);
+extern blake2sp_stripes_fn blake2sp_stripes;
+void blake2sp_stripes_generic(BLAKE2S_CTX leaf[BLAKE2SP_LEAVES], const uint8_t *in, size_t stripes);
+
+#endif /* BLAKE2SP_H */
@@ -10,9 +10,15 @@ $sources = @(
     "crypto/md5/md5.c",
     "crypto/sha0/sha0.c",
     "crypto/sha1/sha1.c",
+    "crypto/sha1/sha1_shani.c",
     "crypto/sha224/sha224.c",
     "crypto/sha256/sha256.c",
+    "crypto/sha256/sha256_shani.c",
+    "crypto/sha256/sha256_avx2.c",
+    "crypto/sha256/sha256_avx512.c",
     "crypto/sha512/sha512.c",
+    "crypto/sha512/sha512_avx2.c",
+    "crypto/sha512/sha512_avx512.c",
     "crypto/sha3/sha3.c",
     "crypto/sha3_224/sha3_224.c",
     "crypto/sha3_384/sha3_384.c",
@@ -23,10 +29,21 @@ $sources = @(
     "crypto/ripemd256/ripemd256.c",
     "crypto/ripemd320/ripemd320.c",
     "crypto/blake2b/blake2b.c",
+    "crypto/blake2b/blake2b_avx2.c",
     "crypto/blake2s/blake2s.c",
+    "crypto/blake2s/blake2s_ssse3.c",
+    "crypto/blake2bp/blake2bp.c",
+    "crypto/blake2sp/blake2sp.c",
     "crypto/whirlpool/whirlpool.c",
+    "crypto/whirlpool/whirlpool_gfni.c",
     "crypto/has160/has160.c",
     "crypto/nt/nt.c",
+    "crypto/registry/hash_registry.c",
+    "crypto/cpu/cpu_features.c",
+    "crypto/md_lanes/md_lanes.c",
+    "crypto/keccak1600/keccak1600.c",
+    "crypto/keccak1600/keccak1600_lanes.c",
+    "crypto/blake2_lanes/blake2_lanes.c",
     "crypto/main.c"
 )
 
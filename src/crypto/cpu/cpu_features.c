@@ -0,0 +1,157 @@
+/*
+ * Runtime CPU feature detection (cpuid / getauxval / sysctl)
+ */
+
+#include "cpu_features.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(CPU_X86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+#if defined(CPU_ARM64) && (defined(__linux__) || defined(__ANDROID__))
+    #include <sys/auxv.h>
+    #ifndef HWCAP_SHA1
+        #define HWCAP_SHA1 (1 << 5)
+    #endif
+    #ifndef HWCAP_SHA2
+        #define HWCAP_SHA2 (1 << 6)
+    #endif
+    #ifndef HWCAP_SHA3
+        #define HWCAP_SHA3 (1 << 17)
+    #endif
+    #ifndef HWCAP_SHA512
+        #define HWCAP_SHA512 (1 << 21)
+    #endif
+#elif defined(CPU_ARM64) && defined(__APPLE__)
+    #include <sys/sysctl.h>
+#endif
+
+#if defined(CPU_X86)
+static void cpuid(uint32_t leaf, uint32_t sub, uint32_t r[4]) {
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuidex(regs, (int)leaf, (int)sub);
+    for (int i = 0; i < 4; i++) r[i] = (uint32_t)regs[i];
+#else
+    __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+static uint64_t xgetbv0(void) {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+static uint32_t detect(void) {
+    uint32_t r[4], f = 0;
+
+    cpuid(0, 0, r);
+    uint32_t max_leaf = r[0];
+    if (max_leaf < 1) return 0;
+
+    cpuid(1, 0, r);
+    if (r[3] & (1u << 26)) f |= CPU_SSE2;
+    if (r[2] & (1u << 9))  f |= CPU_SSSE3;
+    if (r[2] & (1u << 19)) f |= CPU_SSE41;
+
+    // AVX state must be enabled by the OS (OSXSAVE + XCR0 bits)
+    int ymm = 0, zmm = 0;
+    if ((r[2] & (1u << 27)) && (r[2] & (1u << 28))) {
+        uint64_t xcr0 = xgetbv0();
+        ymm = (xcr0 & 0x6) == 0x6;
+        zmm = ymm && (xcr0 & 0xE0) == 0xE0;
+    }
+
+    if (max_leaf >= 7) {
+        cpuid(7, 0, r);
+        if (ymm && (r[1] & (1u << 5))) f |= CPU_AVX2;
+        if (r[1] & (1u << 8))          f |= CPU_BMI2;
+        if (zmm && (r[1] & (1u << 16))) f |= CPU_AVX512F;
+        if (zmm && (r[1] & (1u << 30))) f |= CPU_AVX512BW;
+        if (zmm && (r[1] & (1u << 31))) f |= CPU_AVX512VL;
+        if (r[1] & (1u << 29))         f |= CPU_SHA;
+        if (r[2] & (1u << 8))          f |= CPU_GFNI;
+        if (zmm && (r[2] & (1u << 1))) f |= CPU_AVX512VBMI;
+    }
+    return f;
+}
+#elif defined(CPU_ARM64)
+static uint32_t detect(void) {
+    uint32_t f = CPU_NEON;  // mandatory on AArch64
+#if defined(__linux__) || defined(__ANDROID__)
+    unsigned long hw = getauxval(AT_HWCAP);
+    if (hw & HWCAP_SHA1)   f |= CPU_ARM_SHA1;
+    if (hw & HWCAP_SHA2)   f |= CPU_ARM_SHA2;
+    if (hw & HWCAP_SHA3)   f |= CPU_ARM_SHA3;
+    if (hw & HWCAP_SHA512) f |= CPU_ARM_SHA512;
+#elif defined(__APPLE__)
+    int v = 0;
+    size_t len = sizeof(v);
+    f |= CPU_ARM_SHA1 | CPU_ARM_SHA2;   // every Apple Silicon core has them
+    if (sysctlbyname("hw.optional.armv8_2_sha3", &v, &len, NULL, 0) == 0 && v) f |= CPU_ARM_SHA3;
+    len = sizeof(v);
+    if (sysctlbyname("hw.optional.armv8_2_sha512", &v, &len, NULL, 0) == 0 && v) f |= CPU_ARM_SHA512;
+#endif
+    return f;
+}
+#else
+static uint32_t detect(void) {
+    return 0;
+}
+#endif
+
+// Detection is idempotent, so a racing first call just computes it twice;
+// the release store of detected_valid publishes the mask written before it
+static atomic_int detected_valid = 0;
+static atomic_uint detected_mask = 0;
+static atomic_uint forced_mask = CPU_ALL;
+
+uint32_t cpu_features_detected(void) {
+    if (!atomic_load_explicit(&detected_valid, memory_order_acquire)) {
+        atomic_store_explicit(&detected_mask, detect(), memory_order_relaxed);
+        atomic_store_explicit(&detected_valid, 1, memory_order_release);
+    }
+    return atomic_load_explicit(&detected_mask, memory_order_relaxed);
+}
+
+uint32_t cpu_features(void) {
+    return cpu_features_detected() & atomic_load_explicit(&forced_mask, memory_order_relaxed);
+}
+
+uint32_t cpu_features_force(uint32_t mask) {
+    atomic_store_explicit(&forced_mask, mask, memory_order_relaxed);
+    return cpu_features();
+}
+
+void cpu_features_describe(uint32_t mask, char *buf, int size) {
+    static const struct { uint32_t bit; const char *name; } names[] = {
+        { CPU_SSE2, "sse2" }, { CPU_SSSE3, "ssse3" }, { CPU_SSE41, "sse4.1" },
+        { CPU_AVX2, "avx2" }, { CPU_BMI2, "bmi2" }, { CPU_AVX512F, "avx512f" },
+        { CPU_AVX512BW, "avx512bw" }, { CPU_AVX512VL, "avx512vl" }, { CPU_SHA, "sha" },
+        { CPU_GFNI, "gfni" }, { CPU_AVX512VBMI, "avx512vbmi" }, { CPU_NEON, "neon" },
+        { CPU_ARM_SHA1, "sha1" }, { CPU_ARM_SHA2, "sha2" }, { CPU_ARM_SHA3, "sha3" },
+        { CPU_ARM_SHA512, "sha512" },
+    };
+    int pos = 0;
+
+    if (size <= 0) return;
+    buf[0] = '\0';
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (!(mask & names[i].bit)) continue;
+        int n = snprintf(buf + pos, (size_t)(size - pos), pos ? " %s" : "%s", names[i].name);
+        if (n < 0 || n >= size - pos) break;
+        pos += n;
+    }
+}
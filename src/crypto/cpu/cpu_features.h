@@ -0,0 +1,68 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+/*
+ * Runtime CPU feature detection
+ *
+ * x86 uses cpuid (and xgetbv to check that the OS saves the wide vector
+ * registers), ARM uses getauxval/sysctl. Kernels built for a wider ISA are
+ * compiled with per-function target attributes and only selected when the
+ * matching bits are present, so one binary runs everywhere.
+ */
+
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define CPU_X86 1
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define CPU_ARM64 1
+#endif
+
+/* Per-function ISA targets for the x86 kernels (GCC and Clang) */
+#if defined(CPU_X86) && (defined(__GNUC__) || defined(__clang__)) && !defined(__EMSCRIPTEN__)
+    #define CPU_X86_KERNELS 1
+#endif
+
+/* NEON is baseline on AArch64, so its kernels need no target attributes */
+#if defined(CPU_ARM64) && (defined(__GNUC__) || defined(__clang__))
+    #define CPU_ARM64_KERNELS 1
+#endif
+
+/* Feature bits */
+#define CPU_SSE2        (1u << 0)
+#define CPU_SSSE3       (1u << 1)
+#define CPU_SSE41       (1u << 2)
+#define CPU_AVX2        (1u << 3)
+#define CPU_BMI2        (1u << 4)
+#define CPU_AVX512F     (1u << 5)
+#define CPU_AVX512BW    (1u << 6)
+#define CPU_AVX512VL    (1u << 7)
+#define CPU_SHA         (1u << 8)   /* x86 SHA extensions (SHA-1, SHA-256) */
+#define CPU_GFNI        (1u << 9)
+#define CPU_AVX512VBMI  (1u << 10)  /* byte permutes (vpermb, vpermi2b) */
+#define CPU_NEON        (1u << 16)
+#define CPU_ARM_SHA1    (1u << 17)
+#define CPU_ARM_SHA2    (1u << 18)
+#define CPU_ARM_SHA3    (1u << 19)
+#define CPU_ARM_SHA512  (1u << 20)
+
+#define CPU_ALL         0xFFFFFFFFu
+
+/* Features detected on this CPU, restricted by cpu_features_force() */
+uint32_t cpu_features(void);
+
+/* Features detected on this CPU, ignoring any forced mask */
+uint32_t cpu_features_detected(void);
+
+/*
+ * Restrict the features kernels may use to mask & detected (CPU_ALL undoes
+ * it, 0 forces the portable scalar code). Meant for testing and
+ * benchmarking; call it while no search is running. Returns the new mask.
+ */
+uint32_t cpu_features_force(uint32_t mask);
+
+/* Space-separated feature names for mask, written to buf (always terminated) */
+void cpu_features_describe(uint32_t mask, char *buf, int size);
+
+#endif /* CPU_FEATURES_H */
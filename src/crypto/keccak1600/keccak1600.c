@@ -0,0 +1,195 @@
+/*
+ * Keccak-f[1600] permutation and the sponge helpers shared by the SHA-3,
+ * Keccak and SHAKE modules
+ */
+
+#include "keccak1600.h"
+#include <string.h>
+
+#define ROTL64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+const uint64_t keccak_f1600_rc[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/*
+ * One round from the lanes A## into E##, theta, rho, pi, chi and iota fused
+ * with every lane in a local. Lanes are named by row (b g k m s = y 0..4)
+ * and column (a e i o u = x 0..4).
+ *
+ * Lane complementing: the lanes be, bi, go, ki, mi and sa are kept inverted.
+ * That set is a fixed point of the round when chi's a ^ (~b & c) is
+ * rewritten per lane with AND/OR and De Morgan, so a round needs 5 NOTs
+ * instead of 25, and only keccak_f1600's entry and exit invert the lanes.
+ */
+#define KECCAK_ROUND(A, E, rc)                      \
+    do {                                            \
+        C0 = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa; \
+        C1 = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se; \
+        C2 = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si; \
+        C3 = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so; \
+        C4 = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su; \
+        D0 = C4 ^ ROTL64(C1, 1);                    \
+        D1 = C0 ^ ROTL64(C2, 1);                    \
+        D2 = C1 ^ ROTL64(C3, 1);                    \
+        D3 = C2 ^ ROTL64(C4, 1);                    \
+        D4 = C3 ^ ROTL64(C0, 1);                    \
+        B0 = A##ba ^ D0;                            \
+        B1 = ROTL64(A##ge ^ D1, 44);                \
+        B2 = ROTL64(A##ki ^ D2, 43);                \
+        B3 = ROTL64(A##mo ^ D3, 21);                \
+        B4 = ROTL64(A##su ^ D4, 14);                \
+        E##ba = B0 ^ (B1 | B2) ^ (rc);              \
+        E##be = B1 ^ (~B2 | B3);                    \
+        E##bi = B2 ^ (B3 & B4);                     \
+        E##bo = B3 ^ (B4 | B0);                     \
+        E##bu = B4 ^ (B0 & B1);                     \
+        B0 = ROTL64(A##bo ^ D3, 28);                \
+        B1 = ROTL64(A##gu ^ D4, 20);                \
+        B2 = ROTL64(A##ka ^ D0, 3);                 \
+        B3 = ROTL64(A##me ^ D1, 45);                \
+        B4 = ROTL64(A##si ^ D2, 61);                \
+        E##ga = B0 ^ (B1 | B2);                     \
+        E##ge = B1 ^ (B2 & B3);                     \
+        E##gi = B2 ^ (B3 | ~B4);                    \
+        E##go = B3 ^ (B4 | B0);                     \
+        E##gu = B4 ^ (B0 & B1);                     \
+        B0 = ROTL64(A##be ^ D1, 1);                 \
+        B1 = ROTL64(A##gi ^ D2, 6);                 \
+        B2 = ROTL64(A##ko ^ D3, 25);                \
+        B3 = ROTL64(A##mu ^ D4, 8);                 \
+        B4 = ROTL64(A##sa ^ D0, 18);                \
+        E##ka = B0 ^ (B1 | B2);                     \
+        E##ke = B1 ^ (B2 & B3);                     \
+        E##ki = B2 ^ (~B3 & B4);                    \
+        E##ko = ~B3 ^ (B4 | B0);                    \
+        E##ku = B4 ^ (B0 & B1);                     \
+        B0 = ROTL64(A##bu ^ D4, 27);                \
+        B1 = ROTL64(A##ga ^ D0, 36);                \
+        B2 = ROTL64(A##ke ^ D1, 10);                \
+        B3 = ROTL64(A##mi ^ D2, 15);                \
+        B4 = ROTL64(A##so ^ D3, 56);                \
+        E##ma = B0 ^ (B1 & B2);                     \
+        E##me = B1 ^ (B2 | B3);                     \
+        E##mi = B2 ^ (~B3 | B4);                    \
+        E##mo = ~B3 ^ (B4 & B0);                    \
+        E##mu = B4 ^ (B0 | B1);                     \
+        B0 = ROTL64(A##bi ^ D2, 62);                \
+        B1 = ROTL64(A##go ^ D3, 55);                \
+        B2 = ROTL64(A##ku ^ D4, 39);                \
+        B3 = ROTL64(A##ma ^ D0, 41);                \
+        B4 = ROTL64(A##se ^ D1, 2);                 \
+        E##sa = B0 ^ (~B1 & B2);                    \
+        E##se = ~B1 ^ (B2 | B3);                    \
+        E##si = B2 ^ (B3 & B4);                     \
+        E##so = B3 ^ (B4 | B0);                     \
+        E##su = B4 ^ (B0 & B1);                     \
+    } while (0)
+
+void keccak_f1600(uint64_t state[25]) {
+    uint64_t Aba, Abe, Abi, Abo, Abu, Aga, Age, Agi, Ago, Agu, Aka, Ake, Aki,
+             Ako, Aku, Ama, Ame, Ami, Amo, Amu, Asa, Ase, Asi, Aso, Asu;
+    uint64_t Eba, Ebe, Ebi, Ebo, Ebu, Ega, Ege, Egi, Ego, Egu, Eka, Eke, Eki,
+             Eko, Eku, Ema, Eme, Emi, Emo, Emu, Esa, Ese, Esi, Eso, Esu;
+    uint64_t C0, C1, C2, C3, C4, D0, D1, D2, D3, D4, B0, B1, B2, B3, B4;
+
+    Aba = state[0];
+    Abe = ~state[1];
+    Abi = ~state[2];
+    Abo = state[3];
+    Abu = state[4];
+    Aga = state[5];
+    Age = state[6];
+    Agi = state[7];
+    Ago = ~state[8];
+    Agu = state[9];
+    Aka = state[10];
+    Ake = state[11];
+    Aki = ~state[12];
+    Ako = state[13];
+    Aku = state[14];
+    Ama = state[15];
+    Ame = state[16];
+    Ami = ~state[17];
+    Amo = state[18];
+    Amu = state[19];
+    Asa = ~state[20];
+    Ase = state[21];
+    Asi = state[22];
+    Aso = state[23];
+    Asu = state[24];
+
+    for (int r = 0; r < 24; r += 2) {
+        KECCAK_ROUND(A, E, keccak_f1600_rc[r]);
+        KECCAK_ROUND(E, A, keccak_f1600_rc[r + 1]);
+    }
+
+    state[0] = Aba;
+    state[1] = ~Abe;
+    state[2] = ~Abi;
+    state[3] = Abo;
+    state[4] = Abu;
+    state[5] = Aga;
+    state[6] = Age;
+    state[7] = Agi;
+    state[8] = ~Ago;
+    state[9] = Agu;
+    state[10] = Aka;
+    state[11] = Ake;
+    state[12] = ~Aki;
+    state[13] = Ako;
+    state[14] = Aku;
+    state[15] = Ama;
+    state[16] = Ame;
+    state[17] = ~Ami;
+    state[18] = Amo;
+    state[19] = Amu;
+    state[20] = ~Asa;
+    state[21] = Ase;
+    state[22] = Asi;
+    state[23] = Aso;
+    state[24] = Asu;
+}
+
+static inline uint64_t load64_le(const uint8_t *p) {
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+static void keccak_absorb_block(uint64_t state[25], const uint8_t *block, size_t rate) {
+    for (size_t j = 0; j < rate / 8; j++) state[j] ^= load64_le(block + 8 * j);
+    keccak_f1600(state);
+}
+
+void keccak_absorb(uint64_t state[25], uint8_t *buffer, size_t *buf_len, size_t rate, const uint8_t *data,
+                   size_t len) {
+    if (*buf_len) {
+        size_t take = rate - *buf_len < len ? rate - *buf_len : len;
+        memcpy(buffer + *buf_len, data, take);
+        *buf_len += take;
+        data += take;
+        len -= take;
+        if (*buf_len < rate) return;
+        keccak_absorb_block(state, buffer, rate);
+        *buf_len = 0;
+    }
+    for (; len >= rate; data += rate, len -= rate) keccak_absorb_block(state, data, rate);
+    memcpy(buffer, data, len);
+    *buf_len = len;
+}
+
+void keccak_pad(uint64_t state[25], const uint8_t *buffer, size_t buf_len, size_t rate, uint8_t domain) {
+    for (size_t i = 0; i < buf_len; i++) state[i / 8] ^= (uint64_t)buffer[i] << (8 * (i % 8));
+    state[buf_len / 8] ^= (uint64_t)domain << (8 * (buf_len % 8));
+    state[rate / 8 - 1] ^= 0x8000000000000000ULL;
+    keccak_f1600(state);
+}
+
+void keccak_extract(const uint64_t state[25], size_t offset, uint8_t *out, size_t len) {
+    for (size_t i = 0; i < len; i++, offset++) out[i] = (uint8_t)(state[offset / 8] >> (8 * (offset % 8)));
+}
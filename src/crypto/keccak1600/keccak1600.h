@@ -0,0 +1,56 @@
+#ifndef KECCAK1600_H
+#define KECCAK1600_H
+
+/*
+ * Keccak-f[1600] permutation and sponge helpers
+ *
+ * The one permutation behind SHA3-224/256/384/512, Keccak-224/256/384/512
+ * and SHAKE128/256. The modules keep their own contexts and only differ in
+ * rate, domain padding byte and output length:
+ *
+ *   SHA-3   KECCAK_DOMAIN_SHA3   (0x06)
+ *   Keccak  KECCAK_DOMAIN_KECCAK (0x01)
+ *   SHAKE   KECCAK_DOMAIN_SHAKE  (0x1F)
+ *
+ * The state is 25 little-endian lanes, state[x + 5 * y].
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define KECCAK_DOMAIN_KECCAK 0x01
+#define KECCAK_DOMAIN_SHA3   0x06
+#define KECCAK_DOMAIN_SHAKE  0x1F
+
+// Round constants, shared with the lane kernels
+extern const uint64_t keccak_f1600_rc[24];
+
+// The 24-round permutation
+void keccak_f1600(uint64_t state[25]);
+
+// Absorb data at `rate` bytes per block. buffer/buf_len hold the partial
+// block between calls; whole blocks are XORed into the state directly.
+void keccak_absorb(uint64_t state[25], uint8_t *buffer, size_t *buf_len, size_t rate, const uint8_t *data,
+                   size_t len);
+
+// Pad the buffered partial block with `domain` ... 0x80 and permute
+void keccak_pad(uint64_t state[25], const uint8_t *buffer, size_t buf_len, size_t rate, uint8_t domain);
+
+// Copy len bytes of the state, starting at byte offset, to out
+void keccak_extract(const uint64_t state[25], size_t offset, uint8_t *out, size_t len);
+
+// Multi-lane search kernels (x86 only, keccak1600_lanes.c). Finish 4 or 8
+// messages that continue the absorbed sponge (state, buffer, buf_len) with
+// equally long tails (at most KECCAK_LANES_MAX_TAIL bytes), pad them with
+// `domain` and squeeze out_len bytes (out_len <= rate). Returns the mask of
+// lanes whose digest has at least `difficulty` leading zero bits; only those
+// lanes' digests are written, to digests + out_len * lane.
+#define KECCAK_LANES_MAX_TAIL 32
+uint32_t keccak_finish_x4_avx2(const uint64_t state[25], const uint8_t *buffer, size_t buf_len, size_t rate,
+                               uint8_t domain, size_t out_len, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests);
+uint32_t keccak_finish_x8_avx512(const uint64_t state[25], const uint8_t *buffer, size_t buf_len, size_t rate,
+                                 uint8_t domain, size_t out_len, const uint8_t *const *tails, size_t tail_len,
+                                 int difficulty, uint8_t *digests);
+
+#endif /* KECCAK1600_H */
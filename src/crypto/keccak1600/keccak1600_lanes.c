@@ -0,0 +1,155 @@
+/*
+ * Multi-lane Keccak-f[1600] search kernels - shared lane loader and the
+ * per-ISA instantiations of keccak1600_tmpl.h
+ */
+
+#include "keccak1600.h"
+#include "../cpu/cpu_features.h"
+#include <string.h>
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+/* Final blocks of a lane group: shared words plus the words that differ */
+typedef struct {
+    int nblocks;            /* 1 or 2 */
+    int first, last;        /* words [first, last] come from the tails */
+    uint64_t base[2 * 25];  /* every other word, the same in all lanes */
+} KeccakLanesLayout;
+
+#define KECCAK_LANES_VAR_WORDS 5    /* a 32-byte tail spans at most 5 words */
+
+static inline uint64_t kl_load64(const uint8_t *p) {
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+/*
+ * Lay out the padded final blocks of `lanes` messages that continue a sponge
+ * (buffer holding buf_len bytes of the open block) with equally long tails.
+ * Word t counts across both blocks, block b starting at b * rate / 8. Shared
+ * words go to lay->base; the tail words are sliced by lane,
+ * var[(t - first) * lanes + lane].
+ */
+static void keccak_lanes_blocks(const uint8_t *buffer, size_t buf_len, size_t rate, uint8_t domain,
+                                const uint8_t *const *tails, size_t tail_len, int lanes, KeccakLanesLayout *lay,
+                                uint64_t *var) {
+    uint8_t block[2 * 200];
+    size_t used = buf_len + tail_len;
+    size_t end = used < rate ? rate : 2 * rate;
+
+    memcpy(block, buffer, buf_len);
+    memset(block + buf_len, 0, end - buf_len);
+    block[used] ^= domain;
+    block[end - 1] ^= 0x80;
+
+    lay->nblocks = (int)(end / rate);
+    lay->first = (int)(buf_len / 8);
+    lay->last = tail_len ? (int)((used - 1) / 8) : lay->first - 1;
+    for (size_t t = 0; t < end / 8; t++) lay->base[t] = kl_load64(block + 8 * t);
+
+    for (int lane = 0; lane < lanes; lane++) {
+        memcpy(block + buf_len, tails[lane], tail_len);
+        for (int t = lay->first; t <= lay->last; t++) var[(t - lay->first) * lanes + lane] = kl_load64(block + 8 * t);
+    }
+}
+
+// Little-endian digests of the lanes in mask; h[t * lanes + lane] is state word t
+static void keccak_lanes_store(const uint64_t *h, int lanes, uint32_t mask, size_t out_len, uint8_t *digests) {
+    for (int lane = 0; lane < lanes; lane++) {
+        if (!(mask & (1u << lane))) continue;
+        uint8_t *out = digests + out_len * lane;
+        for (size_t i = 0; i < out_len; i++) out[i] = (uint8_t)(h[(i / 8) * lanes + lane] >> (8 * (i % 8)));
+    }
+}
+
+/* Round in the template's vector type: KL_ROL, KL_XOR5 and KL_CHI (a ^ (~b & c)) come per ISA */
+#define KL_ROUND(A, E, rc)                               \
+    do {                                                 \
+        C0 = KL_XOR5(A##ba, A##ga, A##ka, A##ma, A##sa); \
+        C1 = KL_XOR5(A##be, A##ge, A##ke, A##me, A##se); \
+        C2 = KL_XOR5(A##bi, A##gi, A##ki, A##mi, A##si); \
+        C3 = KL_XOR5(A##bo, A##go, A##ko, A##mo, A##so); \
+        C4 = KL_XOR5(A##bu, A##gu, A##ku, A##mu, A##su); \
+        D0 = C4 ^ KL_ROL(C1, 1);                         \
+        D1 = C0 ^ KL_ROL(C2, 1);                         \
+        D2 = C1 ^ KL_ROL(C3, 1);                         \
+        D3 = C2 ^ KL_ROL(C4, 1);                         \
+        D4 = C3 ^ KL_ROL(C0, 1);                         \
+        B0 = A##ba ^ D0;                                 \
+        B1 = KL_ROL(A##ge ^ D1, 44);                     \
+        B2 = KL_ROL(A##ki ^ D2, 43);                     \
+        B3 = KL_ROL(A##mo ^ D3, 21);                     \
+        B4 = KL_ROL(A##su ^ D4, 14);                     \
+        E##ba = KL_CHI(B0, B1, B2) ^ (rc);               \
+        E##be = KL_CHI(B1, B2, B3);                      \
+        E##bi = KL_CHI(B2, B3, B4);                      \
+        E##bo = KL_CHI(B3, B4, B0);                      \
+        E##bu = KL_CHI(B4, B0, B1);                      \
+        B0 = KL_ROL(A##bo ^ D3, 28);                     \
+        B1 = KL_ROL(A##gu ^ D4, 20);                     \
+        B2 = KL_ROL(A##ka ^ D0, 3);                      \
+        B3 = KL_ROL(A##me ^ D1, 45);                     \
+        B4 = KL_ROL(A##si ^ D2, 61);                     \
+        E##ga = KL_CHI(B0, B1, B2);                      \
+        E##ge = KL_CHI(B1, B2, B3);                      \
+        E##gi = KL_CHI(B2, B3, B4);                      \
+        E##go = KL_CHI(B3, B4, B0);                      \
+        E##gu = KL_CHI(B4, B0, B1);                      \
+        B0 = KL_ROL(A##be ^ D1, 1);                      \
+        B1 = KL_ROL(A##gi ^ D2, 6);                      \
+        B2 = KL_ROL(A##ko ^ D3, 25);                     \
+        B3 = KL_ROL(A##mu ^ D4, 8);                      \
+        B4 = KL_ROL(A##sa ^ D0, 18);                     \
+        E##ka = KL_CHI(B0, B1, B2);                      \
+        E##ke = KL_CHI(B1, B2, B3);                      \
+        E##ki = KL_CHI(B2, B3, B4);                      \
+        E##ko = KL_CHI(B3, B4, B0);                      \
+        E##ku = KL_CHI(B4, B0, B1);                      \
+        B0 = KL_ROL(A##bu ^ D4, 27);                     \
+        B1 = KL_ROL(A##ga ^ D0, 36);                     \
+        B2 = KL_ROL(A##ke ^ D1, 10);                     \
+        B3 = KL_ROL(A##mi ^ D2, 15);                     \
+        B4 = KL_ROL(A##so ^ D3, 56);                     \
+        E##ma = KL_CHI(B0, B1, B2);                      \
+        E##me = KL_CHI(B1, B2, B3);                      \
+        E##mi = KL_CHI(B2, B3, B4);                      \
+        E##mo = KL_CHI(B3, B4, B0);                      \
+        E##mu = KL_CHI(B4, B0, B1);                      \
+        B0 = KL_ROL(A##bi ^ D2, 62);                     \
+        B1 = KL_ROL(A##go ^ D3, 55);                     \
+        B2 = KL_ROL(A##ku ^ D4, 39);                     \
+        B3 = KL_ROL(A##ma ^ D0, 41);                     \
+        B4 = KL_ROL(A##se ^ D1, 2);                      \
+        E##sa = KL_CHI(B0, B1, B2);                      \
+        E##se = KL_CHI(B1, B2, B3);                      \
+        E##si = KL_CHI(B2, B3, B4);                      \
+        E##so = KL_CHI(B3, B4, B0);                      \
+        E##su = KL_CHI(B4, B0, B1);                      \
+    } while (0)
+
+#define KL_LANES 4
+#define KL_ATTR __attribute__((target("avx2")))
+#define KL_NAME(name) name##_x4_avx2
+#define KL_ZERO_LANES(v)                                                                                    \
+    ((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64((__m256i)(v), _mm256_setzero_si256()))))
+#define KL_ROL(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+#define KL_XOR5(a, b, c, d, e) ((a) ^ (b) ^ (c) ^ (d) ^ (e))
+#define KL_CHI(a, b, c) ((a) ^ (~(b) & (c)))
+#include "keccak1600_tmpl.h"
+
+// AVX-512F: native 64-bit rotates, and chi and the column parity as
+// three-input logic (0xD2 = a ^ (~b & c), 0x96 = a ^ b ^ c)
+#define KL_LANES 8
+#define KL_ATTR __attribute__((target("avx512f")))
+#define KL_NAME(name) name##_x8_avx512
+#define KL_ZERO_LANES(v)                                                                                    \
+    ((uint32_t)_mm512_cmpeq_epi64_mask((__m512i)(v), _mm512_setzero_si512()))
+#define KL_ROL(x, n) ((V)_mm512_rol_epi64((__m512i)(x), (n)))
+#define KL_XOR3(a, b, c) ((V)_mm512_ternarylogic_epi64((__m512i)(a), (__m512i)(b), (__m512i)(c), 0x96))
+#define KL_XOR5(a, b, c, d, e) KL_XOR3(KL_XOR3(a, b, c), d, e)
+#define KL_CHI(a, b, c) ((V)_mm512_ternarylogic_epi64((__m512i)(a), (__m512i)(b), (__m512i)(c), 0xD2))
+#include "keccak1600_tmpl.h"
+#undef KL_XOR3
+
+#endif /* CPU_X86_KERNELS */
@@ -0,0 +1,146 @@
+/*
+ * One ISA instantiation of the multi-lane Keccak-f[1600] kernel.
+ * keccak1600_lanes.c includes this file once per ISA with KL_LANES, KL_ATTR,
+ * KL_NAME and the KL_ROL / KL_XOR5 / KL_CHI operations defined. Lanes are
+ * GCC/Clang vectors of 64-bit words, one message per element.
+ */
+
+typedef uint64_t KL_NAME(kl_vec) __attribute__((vector_size(KL_LANES * 8)));
+#define V KL_NAME(kl_vec)
+
+static inline KL_ATTR __attribute__((always_inline))
+void KL_NAME(keccak_permute)(V s[25]) {
+    V Aba, Abe, Abi, Abo, Abu, Aga, Age, Agi, Ago, Agu, Aka, Ake, Aki,
+      Ako, Aku, Ama, Ame, Ami, Amo, Amu, Asa, Ase, Asi, Aso, Asu;
+    V Eba, Ebe, Ebi, Ebo, Ebu, Ega, Ege, Egi, Ego, Egu, Eka, Eke, Eki,
+      Eko, Eku, Ema, Eme, Emi, Emo, Emu, Esa, Ese, Esi, Eso, Esu;
+    V C0, C1, C2, C3, C4, D0, D1, D2, D3, D4, B0, B1, B2, B3, B4;
+
+    Aba = s[0];
+    Abe = s[1];
+    Abi = s[2];
+    Abo = s[3];
+    Abu = s[4];
+    Aga = s[5];
+    Age = s[6];
+    Agi = s[7];
+    Ago = s[8];
+    Agu = s[9];
+    Aka = s[10];
+    Ake = s[11];
+    Aki = s[12];
+    Ako = s[13];
+    Aku = s[14];
+    Ama = s[15];
+    Ame = s[16];
+    Ami = s[17];
+    Amo = s[18];
+    Amu = s[19];
+    Asa = s[20];
+    Ase = s[21];
+    Asi = s[22];
+    Aso = s[23];
+    Asu = s[24];
+
+    for (int r = 0; r < 24; r += 2) {
+        KL_ROUND(A, E, keccak_f1600_rc[r]);
+        KL_ROUND(E, A, keccak_f1600_rc[r + 1]);
+    }
+
+    s[0] = Aba;
+    s[1] = Abe;
+    s[2] = Abi;
+    s[3] = Abo;
+    s[4] = Abu;
+    s[5] = Aga;
+    s[6] = Age;
+    s[7] = Agi;
+    s[8] = Ago;
+    s[9] = Agu;
+    s[10] = Aka;
+    s[11] = Ake;
+    s[12] = Aki;
+    s[13] = Ako;
+    s[14] = Aku;
+    s[15] = Ama;
+    s[16] = Ame;
+    s[17] = Ami;
+    s[18] = Amo;
+    s[19] = Amu;
+    s[20] = Asa;
+    s[21] = Ase;
+    s[22] = Asi;
+    s[23] = Aso;
+    s[24] = Asu;
+}
+
+static inline KL_ATTR __attribute__((always_inline))
+V KL_NAME(keccak_bswap)(V x) {
+    x = ((x & 0x00ff00ff00ff00ffULL) << 8) | ((x >> 8) & 0x00ff00ff00ff00ffULL);
+    x = ((x & 0x0000ffff0000ffffULL) << 16) | ((x >> 16) & 0x0000ffff0000ffffULL);
+    return (x << 32) | (x >> 32);
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits. Digest
+// bytes are the state words little-endian, so compare byte-swapped words.
+// KL_ZERO_LANES, if defined, tests every lane with one compare.
+static inline KL_ATTR __attribute__((always_inline))
+uint32_t KL_NAME(keccak_zero_mask)(const V s[25], size_t out_len, int difficulty) {
+    if (difficulty <= 0) return (1u << KL_LANES) - 1;
+    if ((size_t)difficulty > out_len * 8) return 0;
+
+    V acc = {0};
+    int whole = difficulty / 64, rest = difficulty % 64;
+    for (int i = 0; i < whole; i++) acc |= KL_NAME(keccak_bswap)(s[i]);
+    if (rest) acc |= KL_NAME(keccak_bswap)(s[whole]) >> (64 - rest);
+
+#ifdef KL_ZERO_LANES
+    return KL_ZERO_LANES(acc);
+#else
+    uint32_t mask = 0;
+    for (int lane = 0; lane < KL_LANES; lane++) {
+        if (acc[lane] == 0) mask |= 1u << lane;
+    }
+    return mask;
+#endif
+}
+
+KL_ATTR
+uint32_t KL_NAME(keccak_finish)(const uint64_t state[25], const uint8_t *buffer, size_t buf_len, size_t rate,
+                                uint8_t domain, size_t out_len, const uint8_t *const *tails, size_t tail_len,
+                                int difficulty, uint8_t *digests) {
+    uint64_t var[KECCAK_LANES_VAR_WORDS * KL_LANES], h[25 * KL_LANES];
+    KeccakLanesLayout lay;
+    const V zero = {0};
+    V s[25];
+    int words = (int)(rate / 8);
+
+    keccak_lanes_blocks(buffer, buf_len, rate, domain, tails, tail_len, KL_LANES, &lay, var);
+    for (int i = 0; i < 25; i++) s[i] = zero + state[i];
+    for (int b = 0; b < lay.nblocks; b++) {
+        for (int i = 0; i < words; i++) {
+            int t = b * words + i;
+            V w;
+            if (t >= lay.first && t <= lay.last) memcpy(&w, var + (t - lay.first) * KL_LANES, sizeof(V));
+            else w = zero + lay.base[t];
+            s[i] ^= w;
+        }
+        KL_NAME(keccak_permute)(s);
+    }
+
+    uint32_t mask = KL_NAME(keccak_zero_mask)(s, out_len, difficulty);
+    if (mask) {
+        memcpy(h, s, (out_len + 7) / 8 * sizeof(V));
+        keccak_lanes_store(h, KL_LANES, mask, out_len, digests);
+    }
+    return mask;
+}
+
+#undef V
+#undef KL_LANES
+#undef KL_ATTR
+#undef KL_NAME
+#undef KL_ROL
+#undef KL_XOR5
+#undef KL_CHI
+#undef KL_ZERO_LANES
@@ -146,7 +146,7 @@ void md4_update(MD4_CTX *ctx, const uint8_t *data, size_t len) {
 }
 
 /* Finalize MD4 hash and produce digest */
-void md4_final(uint8_t digest[MD4_DIGEST_LENGTH], MD4_CTX *ctx) {
+void md4_final_state(MD4_CTX *ctx) {
     uint8_t bits[8];
     uint32_t index, padLen;
     static uint8_t padding[64] = { 0x80 };
@@ -166,6 +166,10 @@ void md4_final(uint8_t digest[MD4_DIGEST_LENGTH], MD4_CTX *ctx) {
     
     /* Append length (before padding) */
     md4_update(ctx, bits, 8);
+}
+
+void md4_final(uint8_t digest[MD4_DIGEST_LENGTH], MD4_CTX *ctx) {
+    md4_final_state(ctx);
     
     /* Store state in digest (little-endian) */
     for (int i = 0, j = 0; i < 4; i++, j += 4) {
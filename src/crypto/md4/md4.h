@@ -21,4 +21,8 @@ void md4_update(MD4_CTX *ctx, const uint8_t *data, size_t len);
 void md4_final(uint8_t digest[MD4_DIGEST_LENGTH], MD4_CTX *ctx);
 void md4_hash(const uint8_t *data, size_t len, uint8_t digest[MD4_DIGEST_LENGTH]);
 
+/* md4_final without the output: pads and compresses, leaving the digest
+ * as the little-endian words ctx->state */
+void md4_final_state(MD4_CTX *ctx);
+
 #endif /* MD4_H */
@@ -174,7 +174,7 @@ void md5_update(MD5_CTX *ctx, const uint8_t *data, size_t len) {
 }
 
 /* Finalize MD5 hash and produce digest */
-void md5_final(uint8_t digest[MD5_DIGEST_LENGTH], MD5_CTX *ctx) {
+void md5_final_state(MD5_CTX *ctx) {
     uint8_t bits[8];
     uint32_t index, padLen;
     static uint8_t padding[64] = { 0x80 };
@@ -194,6 +194,10 @@ void md5_final(uint8_t digest[MD5_DIGEST_LENGTH], MD5_CTX *ctx) {
     
     /* Append length (before padding) */
     md5_update(ctx, bits, 8);
+}
+
+void md5_final(uint8_t digest[MD5_DIGEST_LENGTH], MD5_CTX *ctx) {
+    md5_final_state(ctx);
     
     /* Store state in digest (little-endian) */
     for (int i = 0, j = 0; i < 4; i++, j += 4) {
@@ -21,4 +21,7 @@ void md5_update(MD5_CTX *ctx, const uint8_t *data, size_t len);
 void md5_final(uint8_t digest[MD5_DIGEST_LENGTH], MD5_CTX *ctx);
 void md5_hash(const uint8_t *data, size_t len, uint8_t digest[MD5_DIGEST_LENGTH]);
 
+/* md5_final without the output: ctx->state is the digest, little-endian */
+void md5_final_state(MD5_CTX *ctx);
+
 #endif /* MD5_H */
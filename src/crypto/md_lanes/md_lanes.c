@@ -0,0 +1,180 @@
+/*
+ * Multi-lane MD4 / MD5 / NT / RIPEMD kernels - shared lane loader and the
+ * per-ISA instantiations of md_lanes_tmpl.h
+ */
+
+#include "md_lanes.h"
+#include "../cpu/cpu_features.h"
+#include <string.h>
+
+#if defined(CPU_X86_KERNELS) || defined(CPU_ARM64_KERNELS)
+
+/* Final blocks of a lane group: shared words plus the words that differ */
+typedef struct {
+    int nblocks;            /* 1..3 */
+    int first, last;        /* words [first, last] come from the tails */
+    uint32_t base[48];      /* every other word, the same in all lanes */
+} MdLanesLayout;
+
+#define MD_LANES_VAR_WORDS 17   /* a 64-byte (widened) tail spans at most 17 words */
+#define MD_LANES_MAX_WORDS 10   /* RIPEMD-320 */
+
+/* Compression function of md_finish, and its state size in words */
+enum {
+    MD_LANES_MD4,
+    MD_LANES_MD5,
+    MD_LANES_RIPEMD128,
+    MD_LANES_RIPEMD160,
+    MD_LANES_RIPEMD256,
+    MD_LANES_RIPEMD320
+};
+static const int md_lanes_words[] = { 4, 4, 4, 5, 8, 10 };
+
+/*
+ * Lay out the final blocks of `lanes` messages that continue a midstate
+ * (count bits so far, `buffer` holding the partial block) with equally
+ * long tails. Shared words go to lay->base. The tail words are written
+ * little-endian and sliced by lane, var[(t - first) * lanes + lane]. With
+ * `widen` set each tail byte is stored as a UTF-16LE code unit as the lane
+ * is packed, so NT never builds a widened copy of the tail.
+ */
+static void md_lanes_blocks(const uint32_t count[2], const uint8_t buffer[64], const uint8_t *const *tails,
+                            size_t tail_len, int widen, int lanes, MdLanesLayout *lay, uint32_t *var) {
+    uint8_t block[192];
+    size_t off = (count[0] >> 3) & 0x3F;
+    size_t add = widen ? 2 * tail_len : tail_len;
+    size_t used = off + add;
+    size_t end = (used + 9 + 63) / 64 * 64;
+    uint64_t bits = ((((uint64_t)count[1] << 32) | count[0]) + (uint64_t)add * 8);
+
+    memcpy(block, buffer, off);
+    memset(block + off, 0, end - off);
+    block[used] = 0x80;
+    for (int i = 0; i < 8; i++) block[end - 8 + i] = (uint8_t)(bits >> (8 * i));
+
+    lay->nblocks = (int)(end / 64);
+    lay->first = (int)(off / 4);
+    lay->last = add ? (int)((used - 1) / 4) : lay->first - 1;
+    for (int t = 0; t < lay->nblocks * 16; t++) {
+        const uint8_t *p = block + 4 * t;
+        lay->base[t] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    // The odd (high) bytes of widened characters stay zero from the memset
+    for (int lane = 0; lane < lanes; lane++) {
+        const uint8_t *tail = tails[lane];
+        if (widen) {
+            for (size_t i = 0; i < tail_len; i++) block[off + 2 * i] = tail[i];
+        } else {
+            memcpy(block + off, tail, tail_len);
+        }
+        for (int t = lay->first; t <= lay->last; t++) {
+            const uint8_t *p = block + 4 * t;
+            var[(t - lay->first) * lanes + lane] =
+                (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        }
+    }
+}
+
+// Little-endian digests (`words` state words each) of the lanes in mask;
+// h[t * lanes + lane] is state word t
+static void md_lanes_store(const uint32_t *h, int words, int lanes, uint32_t mask, uint8_t *digests) {
+    for (int lane = 0; lane < lanes; lane++) {
+        if (!(mask & (1u << lane))) continue;
+        uint8_t *out = digests + 4 * words * lane;
+        for (int t = 0; t < words; t++) {
+            uint32_t v = h[t * lanes + lane];
+            out[4 * t] = (uint8_t)v;
+            out[4 * t + 1] = (uint8_t)(v >> 8);
+            out[4 * t + 2] = (uint8_t)(v >> 16);
+            out[4 * t + 3] = (uint8_t)(v >> 24);
+        }
+    }
+}
+
+// Characters of an NT tail that still count towards the hash
+static size_t nt_tail_chars(const NT_CTX *mid, size_t tail_len) {
+    if (mid->done || mid->chars >= 256) return 0;
+    return tail_len < 256 - mid->chars ? tail_len : 256 - mid->chars;
+}
+
+/* Round macros; they work on the template's vector types element-wise */
+#define MDL_ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define MDL_BSWAP(x) (((x) << 24) | (((x) & 0xff00) << 8) | (((x) >> 8) & 0xff00) | ((x) >> 24))
+
+#define M4_F(x, y, z) (((x) & (y)) | (~(x) & (z)))
+#define M4_G(x, y, z) (((x) & (y)) | ((x) & (z)) | ((y) & (z)))
+#define M4_H(x, y, z) ((x) ^ (y) ^ (z))
+#define M4_FF(a, b, c, d, x, s) (a) = MDL_ROTL((a) + M4_F((b), (c), (d)) + (x), (s))
+#define M4_GG(a, b, c, d, x, s) (a) = MDL_ROTL((a) + M4_G((b), (c), (d)) + (x) + 0x5a827999u, (s))
+#define M4_HH(a, b, c, d, x, s) (a) = MDL_ROTL((a) + M4_H((b), (c), (d)) + (x) + 0x6ed9eba1u, (s))
+
+#define M5_F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define M5_G(x, y, z) ((y) ^ ((z) & ((x) ^ (y))))
+#define M5_H(x, y, z) ((x) ^ (y) ^ (z))
+#define M5_I(x, y, z) ((y) ^ ((x) | ~(z)))
+#define M5_STEP(f, a, b, c, d, x, s, ac) (a) = (b) + MDL_ROTL((a) + f((b), (c), (d)) + (x) + (uint32_t)(ac), (s))
+#define M5_FF(a, b, c, d, x, s, ac) M5_STEP(M5_F, a, b, c, d, x, s, ac)
+#define M5_GG(a, b, c, d, x, s, ac) M5_STEP(M5_G, a, b, c, d, x, s, ac)
+#define M5_HH(a, b, c, d, x, s, ac) M5_STEP(M5_H, a, b, c, d, x, s, ac)
+#define M5_II(a, b, c, d, x, s, ac) M5_STEP(M5_I, a, b, c, d, x, s, ac)
+
+/* RIPEMD: G and I in their two-operation select forms */
+#define RMD_F(x, y, z) ((x) ^ (y) ^ (z))
+#define RMD_G(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define RMD_H(x, y, z) (((x) | ~(y)) ^ (z))
+#define RMD_I(x, y, z) ((y) ^ ((z) & ((x) ^ (y))))
+#define RMD_J(x, y, z) ((x) ^ ((y) | ~(z)))
+#define RMD_K0  0x00000000u
+#define RMD_K1  0x5a827999u
+#define RMD_K2  0x6ed9eba1u
+#define RMD_K3  0x8f1bbcdcu
+#define RMD_K4  0xa953fd4eu
+#define RMD_KR0 0x50a28be6u
+#define RMD_KR1 0x5c4dd124u
+#define RMD_KR2 0x6d703ef3u
+#define RMD_KR3 0x7a6d76e9u
+/* One step of a 4-word (RIPEMD-128/256) or 5-word (RIPEMD-160/320) line */
+#define RMD4(f, k, a, b, c, d, x, s) (a) = MDL_ROTL((a) + RMD_##f((b), (c), (d)) + (x) + RMD_##k, (s))
+#define RMD5(f, k, a, b, c, d, e, x, s)                                          \
+    do {                                                                         \
+        (a) = MDL_ROTL((a) + RMD_##f((b), (c), (d)) + (x) + RMD_##k, (s)) + (e); \
+        (c) = MDL_ROTL((c), 10);                                                 \
+    } while (0)
+
+#endif
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define MDL_LANES 4
+#define MDL_ATTR __attribute__((target("sse2")))
+#define MDL_NAME(name) name##_x4_sse2
+#define MDL_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32((__m128i)(v), _mm_setzero_si128()))))
+#include "md_lanes_tmpl.h"
+
+#define MDL_LANES 8
+#define MDL_ATTR __attribute__((target("avx2")))
+#define MDL_NAME(name) name##_x8_avx2
+#define MDL_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32((__m256i)(v), _mm256_setzero_si256()))))
+#include "md_lanes_tmpl.h"
+
+#define MDL_LANES 16
+#define MDL_ATTR __attribute__((target("avx512f")))
+#define MDL_NAME(name) name##_x16_avx512
+#define MDL_ZERO_LANES(v)                                                                                   \
+    ((uint32_t)_mm512_cmpeq_epi32_mask((__m512i)(v), _mm512_setzero_si512()))
+#include "md_lanes_tmpl.h"
+
+#endif /* CPU_X86_KERNELS */
+
+#if defined(CPU_ARM64_KERNELS)
+
+#define MDL_LANES 4
+#define MDL_ATTR
+#define MDL_NAME(name) name##_x4_neon
+#include "md_lanes_tmpl.h"
+
+#endif /* CPU_ARM64_KERNELS */
@@ -0,0 +1,54 @@
+#ifndef MD_LANES_H
+#define MD_LANES_H
+
+/*
+ * Multi-lane MD4 / MD5 / NT / RIPEMD kernels for nonce search
+ *
+ * Each call finishes 4, 8 or 16 messages at once, one per 32-bit vector
+ * lane. The messages continue the same midstate with equally long tails
+ * (at most MD_LANES_MAX_TAIL bytes), and the leading-zero test runs on the
+ * vector state. The return value is the mask of lanes whose digest has at
+ * least `difficulty` leading zero bits. Only those lanes' digests are
+ * written, to digests + digest_size * lane.
+ *
+ * The NT kernels widen the tail to UTF-16LE while loading the lanes and
+ * apply nt_update's 256-character limit. Tails must not contain NUL bytes.
+ *
+ * Built per ISA from md_lanes_tmpl.h: SSE2/AVX2/AVX-512F on x86
+ * (CPU_X86_KERNELS), NEON on AArch64 (CPU_ARM64_KERNELS).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../md4/md4.h"
+#include "../md5/md5.h"
+#include "../nt/nt.h"
+#include "../ripemd/ripemd160.h"
+#include "../ripemd128/ripemd128.h"
+#include "../ripemd256/ripemd256.h"
+#include "../ripemd320/ripemd320.h"
+
+#define MD_LANES_MAX_TAIL 32
+
+#define MD_LANES_DECLARE(suffix)                                                                   \
+    uint32_t md4_finish_##suffix(const MD4_CTX *mid, const uint8_t *const *tails, size_t tail_len, \
+                                 int difficulty, uint8_t *digests);                                \
+    uint32_t md5_finish_##suffix(const MD5_CTX *mid, const uint8_t *const *tails, size_t tail_len, \
+                                 int difficulty, uint8_t *digests);                                \
+    uint32_t nt_finish_##suffix(const NT_CTX *mid, const uint8_t *const *tails, size_t tail_len,   \
+                                int difficulty, uint8_t *digests);                                \
+    uint32_t ripemd128_finish_##suffix(const RIPEMD128_CTX *mid, const uint8_t *const *tails,      \
+                                       size_t tail_len, int difficulty, uint8_t *digests);         \
+    uint32_t ripemd160_finish_##suffix(const RIPEMD160_CTX *mid, const uint8_t *const *tails,      \
+                                       size_t tail_len, int difficulty, uint8_t *digests);         \
+    uint32_t ripemd256_finish_##suffix(const RIPEMD256_CTX *mid, const uint8_t *const *tails,      \
+                                       size_t tail_len, int difficulty, uint8_t *digests);         \
+    uint32_t ripemd320_finish_##suffix(const RIPEMD320_CTX *mid, const uint8_t *const *tails,      \
+                                       size_t tail_len, int difficulty, uint8_t *digests);
+
+MD_LANES_DECLARE(x4_sse2)
+MD_LANES_DECLARE(x8_avx2)
+MD_LANES_DECLARE(x16_avx512)
+MD_LANES_DECLARE(x4_neon)
+
+#endif /* MD_LANES_H */
@@ -0,0 +1,500 @@
+/*
+ * One ISA instantiation of the MD4 / MD5 / NT / RIPEMD lane kernels.
+ * md_lanes.c includes this file once per ISA with MDL_LANES, MDL_ATTR and
+ * MDL_NAME defined. It is written with GCC/Clang vector extensions, so the
+ * same source becomes SSE2, AVX2, AVX-512 or NEON code under the function's
+ * target.
+ */
+
+typedef uint32_t MDL_NAME(mdl_vec) __attribute__((vector_size(MDL_LANES * 4)));
+#define V MDL_NAME(mdl_vec)
+
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(md4_block)(V s[4], const V x[16]) {
+    V a = s[0], b = s[1], c = s[2], d = s[3];
+
+    M4_FF(a, b, c, d, x[ 0],  3);
+    M4_FF(d, a, b, c, x[ 1],  7);
+    M4_FF(c, d, a, b, x[ 2], 11);
+    M4_FF(b, c, d, a, x[ 3], 19);
+    M4_FF(a, b, c, d, x[ 4],  3);
+    M4_FF(d, a, b, c, x[ 5],  7);
+    M4_FF(c, d, a, b, x[ 6], 11);
+    M4_FF(b, c, d, a, x[ 7], 19);
+    M4_FF(a, b, c, d, x[ 8],  3);
+    M4_FF(d, a, b, c, x[ 9],  7);
+    M4_FF(c, d, a, b, x[10], 11);
+    M4_FF(b, c, d, a, x[11], 19);
+    M4_FF(a, b, c, d, x[12],  3);
+    M4_FF(d, a, b, c, x[13],  7);
+    M4_FF(c, d, a, b, x[14], 11);
+    M4_FF(b, c, d, a, x[15], 19);
+
+    M4_GG(a, b, c, d, x[ 0],  3);
+    M4_GG(d, a, b, c, x[ 4],  5);
+    M4_GG(c, d, a, b, x[ 8],  9);
+    M4_GG(b, c, d, a, x[12], 13);
+    M4_GG(a, b, c, d, x[ 1],  3);
+    M4_GG(d, a, b, c, x[ 5],  5);
+    M4_GG(c, d, a, b, x[ 9],  9);
+    M4_GG(b, c, d, a, x[13], 13);
+    M4_GG(a, b, c, d, x[ 2],  3);
+    M4_GG(d, a, b, c, x[ 6],  5);
+    M4_GG(c, d, a, b, x[10],  9);
+    M4_GG(b, c, d, a, x[14], 13);
+    M4_GG(a, b, c, d, x[ 3],  3);
+    M4_GG(d, a, b, c, x[ 7],  5);
+    M4_GG(c, d, a, b, x[11],  9);
+    M4_GG(b, c, d, a, x[15], 13);
+
+    M4_HH(a, b, c, d, x[ 0],  3);
+    M4_HH(d, a, b, c, x[ 8],  9);
+    M4_HH(c, d, a, b, x[ 4], 11);
+    M4_HH(b, c, d, a, x[12], 15);
+    M4_HH(a, b, c, d, x[ 2],  3);
+    M4_HH(d, a, b, c, x[10],  9);
+    M4_HH(c, d, a, b, x[ 6], 11);
+    M4_HH(b, c, d, a, x[14], 15);
+    M4_HH(a, b, c, d, x[ 1],  3);
+    M4_HH(d, a, b, c, x[ 9],  9);
+    M4_HH(c, d, a, b, x[ 5], 11);
+    M4_HH(b, c, d, a, x[13], 15);
+    M4_HH(a, b, c, d, x[ 3],  3);
+    M4_HH(d, a, b, c, x[11],  9);
+    M4_HH(c, d, a, b, x[ 7], 11);
+    M4_HH(b, c, d, a, x[15], 15);
+
+    s[0] += a; s[1] += b; s[2] += c; s[3] += d;
+}
+
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(md5_block)(V s[4], const V x[16]) {
+    V a = s[0], b = s[1], c = s[2], d = s[3];
+
+    M5_FF(a, b, c, d, x[ 0],  7, 0xd76aa478);
+    M5_FF(d, a, b, c, x[ 1], 12, 0xe8c7b756);
+    M5_FF(c, d, a, b, x[ 2], 17, 0x242070db);
+    M5_FF(b, c, d, a, x[ 3], 22, 0xc1bdceee);
+    M5_FF(a, b, c, d, x[ 4],  7, 0xf57c0faf);
+    M5_FF(d, a, b, c, x[ 5], 12, 0x4787c62a);
+    M5_FF(c, d, a, b, x[ 6], 17, 0xa8304613);
+    M5_FF(b, c, d, a, x[ 7], 22, 0xfd469501);
+    M5_FF(a, b, c, d, x[ 8],  7, 0x698098d8);
+    M5_FF(d, a, b, c, x[ 9], 12, 0x8b44f7af);
+    M5_FF(c, d, a, b, x[10], 17, 0xffff5bb1);
+    M5_FF(b, c, d, a, x[11], 22, 0x895cd7be);
+    M5_FF(a, b, c, d, x[12],  7, 0x6b901122);
+    M5_FF(d, a, b, c, x[13], 12, 0xfd987193);
+    M5_FF(c, d, a, b, x[14], 17, 0xa679438e);
+    M5_FF(b, c, d, a, x[15], 22, 0x49b40821);
+
+    M5_GG(a, b, c, d, x[ 1],  5, 0xf61e2562);
+    M5_GG(d, a, b, c, x[ 6],  9, 0xc040b340);
+    M5_GG(c, d, a, b, x[11], 14, 0x265e5a51);
+    M5_GG(b, c, d, a, x[ 0], 20, 0xe9b6c7aa);
+    M5_GG(a, b, c, d, x[ 5],  5, 0xd62f105d);
+    M5_GG(d, a, b, c, x[10],  9, 0x02441453);
+    M5_GG(c, d, a, b, x[15], 14, 0xd8a1e681);
+    M5_GG(b, c, d, a, x[ 4], 20, 0xe7d3fbc8);
+    M5_GG(a, b, c, d, x[ 9],  5, 0x21e1cde6);
+    M5_GG(d, a, b, c, x[14],  9, 0xc33707d6);
+    M5_GG(c, d, a, b, x[ 3], 14, 0xf4d50d87);
+    M5_GG(b, c, d, a, x[ 8], 20, 0x455a14ed);
+    M5_GG(a, b, c, d, x[13],  5, 0xa9e3e905);
+    M5_GG(d, a, b, c, x[ 2],  9, 0xfcefa3f8);
+    M5_GG(c, d, a, b, x[ 7], 14, 0x676f02d9);
+    M5_GG(b, c, d, a, x[12], 20, 0x8d2a4c8a);
+
+    M5_HH(a, b, c, d, x[ 5],  4, 0xfffa3942);
+    M5_HH(d, a, b, c, x[ 8], 11, 0x8771f681);
+    M5_HH(c, d, a, b, x[11], 16, 0x6d9d6122);
+    M5_HH(b, c, d, a, x[14], 23, 0xfde5380c);
+    M5_HH(a, b, c, d, x[ 1],  4, 0xa4beea44);
+    M5_HH(d, a, b, c, x[ 4], 11, 0x4bdecfa9);
+    M5_HH(c, d, a, b, x[ 7], 16, 0xf6bb4b60);
+    M5_HH(b, c, d, a, x[10], 23, 0xbebfbc70);
+    M5_HH(a, b, c, d, x[13],  4, 0x289b7ec6);
+    M5_HH(d, a, b, c, x[ 0], 11, 0xeaa127fa);
+    M5_HH(c, d, a, b, x[ 3], 16, 0xd4ef3085);
+    M5_HH(b, c, d, a, x[ 6], 23, 0x04881d05);
+    M5_HH(a, b, c, d, x[ 9],  4, 0xd9d4d039);
+    M5_HH(d, a, b, c, x[12], 11, 0xe6db99e5);
+    M5_HH(c, d, a, b, x[15], 16, 0x1fa27cf8);
+    M5_HH(b, c, d, a, x[ 2], 23, 0xc4ac5665);
+
+    M5_II(a, b, c, d, x[ 0],  6, 0xf4292244);
+    M5_II(d, a, b, c, x[ 7], 10, 0x432aff97);
+    M5_II(c, d, a, b, x[14], 15, 0xab9423a7);
+    M5_II(b, c, d, a, x[ 5], 21, 0xfc93a039);
+    M5_II(a, b, c, d, x[12],  6, 0x655b59c3);
+    M5_II(d, a, b, c, x[ 3], 10, 0x8f0ccc92);
+    M5_II(c, d, a, b, x[10], 15, 0xffeff47d);
+    M5_II(b, c, d, a, x[ 1], 21, 0x85845dd1);
+    M5_II(a, b, c, d, x[ 8],  6, 0x6fa87e4f);
+    M5_II(d, a, b, c, x[15], 10, 0xfe2ce6e0);
+    M5_II(c, d, a, b, x[ 6], 15, 0xa3014314);
+    M5_II(b, c, d, a, x[13], 21, 0x4e0811a1);
+    M5_II(a, b, c, d, x[ 4],  6, 0xf7537e82);
+    M5_II(d, a, b, c, x[11], 10, 0xbd3af235);
+    M5_II(c, d, a, b, x[ 2], 15, 0x2ad7d2bb);
+    M5_II(b, c, d, a, x[ 9], 21, 0xeb86d391);
+
+    s[0] += a; s[1] += b; s[2] += c; s[3] += d;
+}
+
+// Both lines of a RIPEMD-128 (swap 0) or RIPEMD-256 (swap 1) compression.
+// The lines are independent in RIPEMD-128, so running them round by round
+// computes the same thing; RIPEMD-256 exchanges one word after each round.
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(rmd4_lines)(V l[4], V r[4], const V x[16], int swap) {
+    V a = l[0], b = l[1], c = l[2], d = l[3];
+    V aa = r[0], bb = r[1], cc = r[2], dd = r[3], t;
+
+    RMD4(F, K0, a, b, c, d, x[ 0], 11); RMD4(F, K0, d, a, b, c, x[ 1], 14);
+    RMD4(F, K0, c, d, a, b, x[ 2], 15); RMD4(F, K0, b, c, d, a, x[ 3], 12);
+    RMD4(F, K0, a, b, c, d, x[ 4],  5); RMD4(F, K0, d, a, b, c, x[ 5],  8);
+    RMD4(F, K0, c, d, a, b, x[ 6],  7); RMD4(F, K0, b, c, d, a, x[ 7],  9);
+    RMD4(F, K0, a, b, c, d, x[ 8], 11); RMD4(F, K0, d, a, b, c, x[ 9], 13);
+    RMD4(F, K0, c, d, a, b, x[10], 14); RMD4(F, K0, b, c, d, a, x[11], 15);
+    RMD4(F, K0, a, b, c, d, x[12],  6); RMD4(F, K0, d, a, b, c, x[13],  7);
+    RMD4(F, K0, c, d, a, b, x[14],  9); RMD4(F, K0, b, c, d, a, x[15],  8);
+
+    RMD4(I, KR0, aa, bb, cc, dd, x[ 5],  8); RMD4(I, KR0, dd, aa, bb, cc, x[14],  9);
+    RMD4(I, KR0, cc, dd, aa, bb, x[ 7],  9); RMD4(I, KR0, bb, cc, dd, aa, x[ 0], 11);
+    RMD4(I, KR0, aa, bb, cc, dd, x[ 9], 13); RMD4(I, KR0, dd, aa, bb, cc, x[ 2], 15);
+    RMD4(I, KR0, cc, dd, aa, bb, x[11], 15); RMD4(I, KR0, bb, cc, dd, aa, x[ 4],  5);
+    RMD4(I, KR0, aa, bb, cc, dd, x[13],  7); RMD4(I, KR0, dd, aa, bb, cc, x[ 6],  7);
+    RMD4(I, KR0, cc, dd, aa, bb, x[15],  8); RMD4(I, KR0, bb, cc, dd, aa, x[ 8], 11);
+    RMD4(I, KR0, aa, bb, cc, dd, x[ 1], 14); RMD4(I, KR0, dd, aa, bb, cc, x[10], 14);
+    RMD4(I, KR0, cc, dd, aa, bb, x[ 3], 12); RMD4(I, KR0, bb, cc, dd, aa, x[12],  6);
+
+    if (swap) { t = a; a = aa; aa = t; }
+
+    RMD4(G, K1, a, b, c, d, x[ 7],  7); RMD4(G, K1, d, a, b, c, x[ 4],  6);
+    RMD4(G, K1, c, d, a, b, x[13],  8); RMD4(G, K1, b, c, d, a, x[ 1], 13);
+    RMD4(G, K1, a, b, c, d, x[10], 11); RMD4(G, K1, d, a, b, c, x[ 6],  9);
+    RMD4(G, K1, c, d, a, b, x[15],  7); RMD4(G, K1, b, c, d, a, x[ 3], 15);
+    RMD4(G, K1, a, b, c, d, x[12],  7); RMD4(G, K1, d, a, b, c, x[ 0], 12);
+    RMD4(G, K1, c, d, a, b, x[ 9], 15); RMD4(G, K1, b, c, d, a, x[ 5],  9);
+    RMD4(G, K1, a, b, c, d, x[ 2], 11); RMD4(G, K1, d, a, b, c, x[14],  7);
+    RMD4(G, K1, c, d, a, b, x[11], 13); RMD4(G, K1, b, c, d, a, x[ 8], 12);
+
+    RMD4(H, KR1, aa, bb, cc, dd, x[ 6],  9); RMD4(H, KR1, dd, aa, bb, cc, x[11], 13);
+    RMD4(H, KR1, cc, dd, aa, bb, x[ 3], 15); RMD4(H, KR1, bb, cc, dd, aa, x[ 7],  7);
+    RMD4(H, KR1, aa, bb, cc, dd, x[ 0], 12); RMD4(H, KR1, dd, aa, bb, cc, x[13],  8);
+    RMD4(H, KR1, cc, dd, aa, bb, x[ 5],  9); RMD4(H, KR1, bb, cc, dd, aa, x[10], 11);
+    RMD4(H, KR1, aa, bb, cc, dd, x[14],  7); RMD4(H, KR1, dd, aa, bb, cc, x[15],  7);
+    RMD4(H, KR1, cc, dd, aa, bb, x[ 8], 12); RMD4(H, KR1, bb, cc, dd, aa, x[12],  7);
+    RMD4(H, KR1, aa, bb, cc, dd, x[ 4],  6); RMD4(H, KR1, dd, aa, bb, cc, x[ 9], 15);
+    RMD4(H, KR1, cc, dd, aa, bb, x[ 1], 13); RMD4(H, KR1, bb, cc, dd, aa, x[ 2], 11);
+
+    if (swap) { t = b; b = bb; bb = t; }
+
+    RMD4(H, K2, a, b, c, d, x[ 3], 11); RMD4(H, K2, d, a, b, c, x[10], 13);
+    RMD4(H, K2, c, d, a, b, x[14],  6); RMD4(H, K2, b, c, d, a, x[ 4],  7);
+    RMD4(H, K2, a, b, c, d, x[ 9], 14); RMD4(H, K2, d, a, b, c, x[15],  9);
+    RMD4(H, K2, c, d, a, b, x[ 8], 13); RMD4(H, K2, b, c, d, a, x[ 1], 15);
+    RMD4(H, K2, a, b, c, d, x[ 2], 14); RMD4(H, K2, d, a, b, c, x[ 7],  8);
+    RMD4(H, K2, c, d, a, b, x[ 0], 13); RMD4(H, K2, b, c, d, a, x[ 6],  6);
+    RMD4(H, K2, a, b, c, d, x[13],  5); RMD4(H, K2, d, a, b, c, x[11], 12);
+    RMD4(H, K2, c, d, a, b, x[ 5],  7); RMD4(H, K2, b, c, d, a, x[12],  5);
+
+    RMD4(G, KR2, aa, bb, cc, dd, x[15],  9); RMD4(G, KR2, dd, aa, bb, cc, x[ 5],  7);
+    RMD4(G, KR2, cc, dd, aa, bb, x[ 1], 15); RMD4(G, KR2, bb, cc, dd, aa, x[ 3], 11);
+    RMD4(G, KR2, aa, bb, cc, dd, x[ 7],  8); RMD4(G, KR2, dd, aa, bb, cc, x[14],  6);
+    RMD4(G, KR2, cc, dd, aa, bb, x[ 6],  6); RMD4(G, KR2, bb, cc, dd, aa, x[ 9], 14);
+    RMD4(G, KR2, aa, bb, cc, dd, x[11], 12); RMD4(G, KR2, dd, aa, bb, cc, x[ 8], 13);
+    RMD4(G, KR2, cc, dd, aa, bb, x[12],  5); RMD4(G, KR2, bb, cc, dd, aa, x[ 2], 14);
+    RMD4(G, KR2, aa, bb, cc, dd, x[10], 13); RMD4(G, KR2, dd, aa, bb, cc, x[ 0], 13);
+    RMD4(G, KR2, cc, dd, aa, bb, x[ 4],  7); RMD4(G, KR2, bb, cc, dd, aa, x[13],  5);
+
+    if (swap) { t = c; c = cc; cc = t; }
+
+    RMD4(I, K3, a, b, c, d, x[ 1], 11); RMD4(I, K3, d, a, b, c, x[ 9], 12);
+    RMD4(I, K3, c, d, a, b, x[11], 14); RMD4(I, K3, b, c, d, a, x[10], 15);
+    RMD4(I, K3, a, b, c, d, x[ 0], 14); RMD4(I, K3, d, a, b, c, x[ 8], 15);
+    RMD4(I, K3, c, d, a, b, x[12],  9); RMD4(I, K3, b, c, d, a, x[ 4],  8);
+    RMD4(I, K3, a, b, c, d, x[13],  9); RMD4(I, K3, d, a, b, c, x[ 3], 14);
+    RMD4(I, K3, c, d, a, b, x[ 7],  5); RMD4(I, K3, b, c, d, a, x[15],  6);
+    RMD4(I, K3, a, b, c, d, x[14],  8); RMD4(I, K3, d, a, b, c, x[ 5],  6);
+    RMD4(I, K3, c, d, a, b, x[ 6],  5); RMD4(I, K3, b, c, d, a, x[ 2], 12);
+
+    RMD4(F, K0, aa, bb, cc, dd, x[ 8], 15); RMD4(F, K0, dd, aa, bb, cc, x[ 6],  5);
+    RMD4(F, K0, cc, dd, aa, bb, x[ 4],  8); RMD4(F, K0, bb, cc, dd, aa, x[ 1], 11);
+    RMD4(F, K0, aa, bb, cc, dd, x[ 3], 14); RMD4(F, K0, dd, aa, bb, cc, x[11], 14);
+    RMD4(F, K0, cc, dd, aa, bb, x[15],  6); RMD4(F, K0, bb, cc, dd, aa, x[ 0], 14);
+    RMD4(F, K0, aa, bb, cc, dd, x[ 5],  6); RMD4(F, K0, dd, aa, bb, cc, x[12],  9);
+    RMD4(F, K0, cc, dd, aa, bb, x[ 2], 12); RMD4(F, K0, bb, cc, dd, aa, x[13],  9);
+    RMD4(F, K0, aa, bb, cc, dd, x[ 9], 12); RMD4(F, K0, dd, aa, bb, cc, x[ 7],  5);
+    RMD4(F, K0, cc, dd, aa, bb, x[10], 15); RMD4(F, K0, bb, cc, dd, aa, x[14],  8);
+
+    if (swap) { t = d; d = dd; dd = t; }
+    l[0] = a; l[1] = b; l[2] = c; l[3] = d;
+    r[0] = aa; r[1] = bb; r[2] = cc; r[3] = dd;
+}
+
+// Both lines of a RIPEMD-160 (swap 0) or RIPEMD-320 (swap 1) compression
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(rmd5_lines)(V l[5], V r[5], const V x[16], int swap) {
+    V a = l[0], b = l[1], c = l[2], d = l[3], e = l[4];
+    V aa = r[0], bb = r[1], cc = r[2], dd = r[3], ee = r[4], t;
+
+    RMD5(F, K0, a, b, c, d, e, x[ 0], 11); RMD5(F, K0, e, a, b, c, d, x[ 1], 14);
+    RMD5(F, K0, d, e, a, b, c, x[ 2], 15); RMD5(F, K0, c, d, e, a, b, x[ 3], 12);
+    RMD5(F, K0, b, c, d, e, a, x[ 4],  5); RMD5(F, K0, a, b, c, d, e, x[ 5],  8);
+    RMD5(F, K0, e, a, b, c, d, x[ 6],  7); RMD5(F, K0, d, e, a, b, c, x[ 7],  9);
+    RMD5(F, K0, c, d, e, a, b, x[ 8], 11); RMD5(F, K0, b, c, d, e, a, x[ 9], 13);
+    RMD5(F, K0, a, b, c, d, e, x[10], 14); RMD5(F, K0, e, a, b, c, d, x[11], 15);
+    RMD5(F, K0, d, e, a, b, c, x[12],  6); RMD5(F, K0, c, d, e, a, b, x[13],  7);
+    RMD5(F, K0, b, c, d, e, a, x[14],  9); RMD5(F, K0, a, b, c, d, e, x[15],  8);
+
+    RMD5(J, KR0, aa, bb, cc, dd, ee, x[ 5],  8); RMD5(J, KR0, ee, aa, bb, cc, dd, x[14],  9);
+    RMD5(J, KR0, dd, ee, aa, bb, cc, x[ 7],  9); RMD5(J, KR0, cc, dd, ee, aa, bb, x[ 0], 11);
+    RMD5(J, KR0, bb, cc, dd, ee, aa, x[ 9], 13); RMD5(J, KR0, aa, bb, cc, dd, ee, x[ 2], 15);
+    RMD5(J, KR0, ee, aa, bb, cc, dd, x[11], 15); RMD5(J, KR0, dd, ee, aa, bb, cc, x[ 4],  5);
+    RMD5(J, KR0, cc, dd, ee, aa, bb, x[13],  7); RMD5(J, KR0, bb, cc, dd, ee, aa, x[ 6],  7);
+    RMD5(J, KR0, aa, bb, cc, dd, ee, x[15],  8); RMD5(J, KR0, ee, aa, bb, cc, dd, x[ 8], 11);
+    RMD5(J, KR0, dd, ee, aa, bb, cc, x[ 1], 14); RMD5(J, KR0, cc, dd, ee, aa, bb, x[10], 14);
+    RMD5(J, KR0, bb, cc, dd, ee, aa, x[ 3], 12); RMD5(J, KR0, aa, bb, cc, dd, ee, x[12],  6);
+
+    if (swap) { t = a; a = aa; aa = t; }
+
+    RMD5(G, K1, e, a, b, c, d, x[ 7],  7); RMD5(G, K1, d, e, a, b, c, x[ 4],  6);
+    RMD5(G, K1, c, d, e, a, b, x[13],  8); RMD5(G, K1, b, c, d, e, a, x[ 1], 13);
+    RMD5(G, K1, a, b, c, d, e, x[10], 11); RMD5(G, K1, e, a, b, c, d, x[ 6],  9);
+    RMD5(G, K1, d, e, a, b, c, x[15],  7); RMD5(G, K1, c, d, e, a, b, x[ 3], 15);
+    RMD5(G, K1, b, c, d, e, a, x[12],  7); RMD5(G, K1, a, b, c, d, e, x[ 0], 12);
+    RMD5(G, K1, e, a, b, c, d, x[ 9], 15); RMD5(G, K1, d, e, a, b, c, x[ 5],  9);
+    RMD5(G, K1, c, d, e, a, b, x[ 2], 11); RMD5(G, K1, b, c, d, e, a, x[14],  7);
+    RMD5(G, K1, a, b, c, d, e, x[11], 13); RMD5(G, K1, e, a, b, c, d, x[ 8], 12);
+
+    RMD5(I, KR1, ee, aa, bb, cc, dd, x[ 6],  9); RMD5(I, KR1, dd, ee, aa, bb, cc, x[11], 13);
+    RMD5(I, KR1, cc, dd, ee, aa, bb, x[ 3], 15); RMD5(I, KR1, bb, cc, dd, ee, aa, x[ 7],  7);
+    RMD5(I, KR1, aa, bb, cc, dd, ee, x[ 0], 12); RMD5(I, KR1, ee, aa, bb, cc, dd, x[13],  8);
+    RMD5(I, KR1, dd, ee, aa, bb, cc, x[ 5],  9); RMD5(I, KR1, cc, dd, ee, aa, bb, x[10], 11);
+    RMD5(I, KR1, bb, cc, dd, ee, aa, x[14],  7); RMD5(I, KR1, aa, bb, cc, dd, ee, x[15],  7);
+    RMD5(I, KR1, ee, aa, bb, cc, dd, x[ 8], 12); RMD5(I, KR1, dd, ee, aa, bb, cc, x[12],  7);
+    RMD5(I, KR1, cc, dd, ee, aa, bb, x[ 4],  6); RMD5(I, KR1, bb, cc, dd, ee, aa, x[ 9], 15);
+    RMD5(I, KR1, aa, bb, cc, dd, ee, x[ 1], 13); RMD5(I, KR1, ee, aa, bb, cc, dd, x[ 2], 11);
+
+    if (swap) { t = b; b = bb; bb = t; }
+
+    RMD5(H, K2, d, e, a, b, c, x[ 3], 11); RMD5(H, K2, c, d, e, a, b, x[10], 13);
+    RMD5(H, K2, b, c, d, e, a, x[14],  6); RMD5(H, K2, a, b, c, d, e, x[ 4],  7);
+    RMD5(H, K2, e, a, b, c, d, x[ 9], 14); RMD5(H, K2, d, e, a, b, c, x[15],  9);
+    RMD5(H, K2, c, d, e, a, b, x[ 8], 13); RMD5(H, K2, b, c, d, e, a, x[ 1], 15);
+    RMD5(H, K2, a, b, c, d, e, x[ 2], 14); RMD5(H, K2, e, a, b, c, d, x[ 7],  8);
+    RMD5(H, K2, d, e, a, b, c, x[ 0], 13); RMD5(H, K2, c, d, e, a, b, x[ 6],  6);
+    RMD5(H, K2, b, c, d, e, a, x[13],  5); RMD5(H, K2, a, b, c, d, e, x[11], 12);
+    RMD5(H, K2, e, a, b, c, d, x[ 5],  7); RMD5(H, K2, d, e, a, b, c, x[12],  5);
+
+    RMD5(H, KR2, dd, ee, aa, bb, cc, x[15],  9); RMD5(H, KR2, cc, dd, ee, aa, bb, x[ 5],  7);
+    RMD5(H, KR2, bb, cc, dd, ee, aa, x[ 1], 15); RMD5(H, KR2, aa, bb, cc, dd, ee, x[ 3], 11);
+    RMD5(H, KR2, ee, aa, bb, cc, dd, x[ 7],  8); RMD5(H, KR2, dd, ee, aa, bb, cc, x[14],  6);
+    RMD5(H, KR2, cc, dd, ee, aa, bb, x[ 6],  6); RMD5(H, KR2, bb, cc, dd, ee, aa, x[ 9], 14);
+    RMD5(H, KR2, aa, bb, cc, dd, ee, x[11], 12); RMD5(H, KR2, ee, aa, bb, cc, dd, x[ 8], 13);
+    RMD5(H, KR2, dd, ee, aa, bb, cc, x[12],  5); RMD5(H, KR2, cc, dd, ee, aa, bb, x[ 2], 14);
+    RMD5(H, KR2, bb, cc, dd, ee, aa, x[10], 13); RMD5(H, KR2, aa, bb, cc, dd, ee, x[ 0], 13);
+    RMD5(H, KR2, ee, aa, bb, cc, dd, x[ 4],  7); RMD5(H, KR2, dd, ee, aa, bb, cc, x[13],  5);
+
+    if (swap) { t = c; c = cc; cc = t; }
+
+    RMD5(I, K3, c, d, e, a, b, x[ 1], 11); RMD5(I, K3, b, c, d, e, a, x[ 9], 12);
+    RMD5(I, K3, a, b, c, d, e, x[11], 14); RMD5(I, K3, e, a, b, c, d, x[10], 15);
+    RMD5(I, K3, d, e, a, b, c, x[ 0], 14); RMD5(I, K3, c, d, e, a, b, x[ 8], 15);
+    RMD5(I, K3, b, c, d, e, a, x[12],  9); RMD5(I, K3, a, b, c, d, e, x[ 4],  8);
+    RMD5(I, K3, e, a, b, c, d, x[13],  9); RMD5(I, K3, d, e, a, b, c, x[ 3], 14);
+    RMD5(I, K3, c, d, e, a, b, x[ 7],  5); RMD5(I, K3, b, c, d, e, a, x[15],  6);
+    RMD5(I, K3, a, b, c, d, e, x[14],  8); RMD5(I, K3, e, a, b, c, d, x[ 5],  6);
+    RMD5(I, K3, d, e, a, b, c, x[ 6],  5); RMD5(I, K3, c, d, e, a, b, x[ 2], 12);
+
+    RMD5(G, KR3, cc, dd, ee, aa, bb, x[ 8], 15); RMD5(G, KR3, bb, cc, dd, ee, aa, x[ 6],  5);
+    RMD5(G, KR3, aa, bb, cc, dd, ee, x[ 4],  8); RMD5(G, KR3, ee, aa, bb, cc, dd, x[ 1], 11);
+    RMD5(G, KR3, dd, ee, aa, bb, cc, x[ 3], 14); RMD5(G, KR3, cc, dd, ee, aa, bb, x[11], 14);
+    RMD5(G, KR3, bb, cc, dd, ee, aa, x[15],  6); RMD5(G, KR3, aa, bb, cc, dd, ee, x[ 0], 14);
+    RMD5(G, KR3, ee, aa, bb, cc, dd, x[ 5],  6); RMD5(G, KR3, dd, ee, aa, bb, cc, x[12],  9);
+    RMD5(G, KR3, cc, dd, ee, aa, bb, x[ 2], 12); RMD5(G, KR3, bb, cc, dd, ee, aa, x[13],  9);
+    RMD5(G, KR3, aa, bb, cc, dd, ee, x[ 9], 12); RMD5(G, KR3, ee, aa, bb, cc, dd, x[ 7],  5);
+    RMD5(G, KR3, dd, ee, aa, bb, cc, x[10], 15); RMD5(G, KR3, cc, dd, ee, aa, bb, x[14],  8);
+
+    if (swap) { t = d; d = dd; dd = t; }
+
+    RMD5(J, K4, b, c, d, e, a, x[ 4],  9); RMD5(J, K4, a, b, c, d, e, x[ 0], 15);
+    RMD5(J, K4, e, a, b, c, d, x[ 5],  5); RMD5(J, K4, d, e, a, b, c, x[ 9], 11);
+    RMD5(J, K4, c, d, e, a, b, x[ 7],  6); RMD5(J, K4, b, c, d, e, a, x[12],  8);
+    RMD5(J, K4, a, b, c, d, e, x[ 2], 13); RMD5(J, K4, e, a, b, c, d, x[10], 12);
+    RMD5(J, K4, d, e, a, b, c, x[14],  5); RMD5(J, K4, c, d, e, a, b, x[ 1], 12);
+    RMD5(J, K4, b, c, d, e, a, x[ 3], 13); RMD5(J, K4, a, b, c, d, e, x[ 8], 14);
+    RMD5(J, K4, e, a, b, c, d, x[11], 11); RMD5(J, K4, d, e, a, b, c, x[ 6],  8);
+    RMD5(J, K4, c, d, e, a, b, x[15],  5); RMD5(J, K4, b, c, d, e, a, x[13],  6);
+
+    RMD5(F, K0, bb, cc, dd, ee, aa, x[12],  8); RMD5(F, K0, aa, bb, cc, dd, ee, x[15],  5);
+    RMD5(F, K0, ee, aa, bb, cc, dd, x[10], 12); RMD5(F, K0, dd, ee, aa, bb, cc, x[ 4],  9);
+    RMD5(F, K0, cc, dd, ee, aa, bb, x[ 1], 12); RMD5(F, K0, bb, cc, dd, ee, aa, x[ 5],  5);
+    RMD5(F, K0, aa, bb, cc, dd, ee, x[ 8], 14); RMD5(F, K0, ee, aa, bb, cc, dd, x[ 7],  6);
+    RMD5(F, K0, dd, ee, aa, bb, cc, x[ 6],  8); RMD5(F, K0, cc, dd, ee, aa, bb, x[ 2], 13);
+    RMD5(F, K0, bb, cc, dd, ee, aa, x[13],  6); RMD5(F, K0, aa, bb, cc, dd, ee, x[14],  5);
+    RMD5(F, K0, ee, aa, bb, cc, dd, x[ 0], 15); RMD5(F, K0, dd, ee, aa, bb, cc, x[ 3], 13);
+    RMD5(F, K0, cc, dd, ee, aa, bb, x[ 9], 11); RMD5(F, K0, bb, cc, dd, ee, aa, x[11], 11);
+
+    if (swap) { t = e; e = ee; ee = t; }
+    l[0] = a; l[1] = b; l[2] = c; l[3] = d; l[4] = e;
+    r[0] = aa; r[1] = bb; r[2] = cc; r[3] = dd; r[4] = ee;
+}
+
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(ripemd128_block)(V s[4], const V x[16]) {
+    V l[4] = {s[0], s[1], s[2], s[3]}, r[4] = {s[0], s[1], s[2], s[3]};
+
+    MDL_NAME(rmd4_lines)(l, r, x, 0);
+    V t = s[1] + l[2] + r[3];
+    s[1] = s[2] + l[3] + r[0];
+    s[2] = s[3] + l[0] + r[1];
+    s[3] = s[0] + l[1] + r[2];
+    s[0] = t;
+}
+
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(ripemd160_block)(V s[5], const V x[16]) {
+    V l[5] = {s[0], s[1], s[2], s[3], s[4]}, r[5] = {s[0], s[1], s[2], s[3], s[4]};
+
+    MDL_NAME(rmd5_lines)(l, r, x, 0);
+    V t = s[1] + l[2] + r[3];
+    s[1] = s[2] + l[3] + r[4];
+    s[2] = s[3] + l[4] + r[0];
+    s[3] = s[4] + l[0] + r[1];
+    s[4] = s[0] + l[1] + r[2];
+    s[0] = t;
+}
+
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(ripemd256_block)(V s[8], const V x[16]) {
+    V l[4] = {s[0], s[1], s[2], s[3]}, r[4] = {s[4], s[5], s[6], s[7]};
+
+    MDL_NAME(rmd4_lines)(l, r, x, 1);
+    for (int i = 0; i < 4; i++) {
+        s[i] += l[i];
+        s[4 + i] += r[i];
+    }
+}
+
+static inline MDL_ATTR __attribute__((always_inline))
+void MDL_NAME(ripemd320_block)(V s[10], const V x[16]) {
+    V l[5] = {s[0], s[1], s[2], s[3], s[4]}, r[5] = {s[5], s[6], s[7], s[8], s[9]};
+
+    MDL_NAME(rmd5_lines)(l, r, x, 1);
+    for (int i = 0; i < 5; i++) {
+        s[i] += l[i];
+        s[5 + i] += r[i];
+    }
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits. Digest
+// bytes are the `words` state words little-endian, so compare byte-swapped
+// words. MDL_ZERO_LANES, if defined, tests every lane with one compare.
+static inline MDL_ATTR __attribute__((always_inline))
+uint32_t MDL_NAME(md_zero_mask)(const V *s, int words, int difficulty) {
+    if (difficulty <= 0) return (1u << MDL_LANES) - 1;
+    if (difficulty > 32 * words) return 0;
+
+    V acc = {0};
+    int whole = difficulty / 32, rest = difficulty % 32;
+    for (int i = 0; i < whole; i++) acc |= MDL_BSWAP(s[i]);
+    if (rest) acc |= MDL_BSWAP(s[whole]) >> (32 - rest);
+
+#ifdef MDL_ZERO_LANES
+    return MDL_ZERO_LANES(acc);
+#else
+    uint32_t mask = 0;
+    for (int lane = 0; lane < MDL_LANES; lane++) {
+        if (acc[lane] == 0) mask |= 1u << lane;
+    }
+    return mask;
+#endif
+}
+
+static MDL_ATTR
+uint32_t MDL_NAME(md_finish)(int algo, const uint32_t *state, const uint32_t count[2], const uint8_t buffer[64],
+                             const uint8_t *const *tails, size_t tail_len, int widen, int difficulty,
+                             uint8_t *digests) {
+    uint32_t var[MD_LANES_VAR_WORDS * MDL_LANES], h[MD_LANES_MAX_WORDS * MDL_LANES];
+    int words = md_lanes_words[algo];
+    MdLanesLayout lay;
+    const V zero = {0};
+    V s[MD_LANES_MAX_WORDS], x[48];
+
+    md_lanes_blocks(count, buffer, tails, tail_len, widen, MDL_LANES, &lay, var);
+    for (int t = 0; t < lay.nblocks * 16; t++) {
+        if (t >= lay.first && t <= lay.last) memcpy(&x[t], var + (t - lay.first) * MDL_LANES, sizeof(V));
+        else x[t] = zero + lay.base[t];
+    }
+    for (int i = 0; i < words; i++) s[i] = zero + state[i];
+    for (int b = 0; b < lay.nblocks; b++) {
+        const V *xb = x + 16 * b;
+        switch (algo) {
+        case MD_LANES_MD4:       MDL_NAME(md4_block)(s, xb); break;
+        case MD_LANES_MD5:       MDL_NAME(md5_block)(s, xb); break;
+        case MD_LANES_RIPEMD128: MDL_NAME(ripemd128_block)(s, xb); break;
+        case MD_LANES_RIPEMD160: MDL_NAME(ripemd160_block)(s, xb); break;
+        case MD_LANES_RIPEMD256: MDL_NAME(ripemd256_block)(s, xb); break;
+        default:                 MDL_NAME(ripemd320_block)(s, xb); break;
+        }
+    }
+
+    uint32_t mask = MDL_NAME(md_zero_mask)(s, words, difficulty);
+    if (mask) {
+        memcpy(h, s, (size_t)words * sizeof(V));
+        md_lanes_store(h, words, MDL_LANES, mask, digests);
+    }
+    return mask;
+}
+
+MDL_ATTR
+uint32_t MDL_NAME(md4_finish)(const MD4_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                              int difficulty, uint8_t *digests) {
+    return MDL_NAME(md_finish)(MD_LANES_MD4, mid->state, mid->count, mid->buffer, tails, tail_len, 0, difficulty,
+                               digests);
+}
+
+MDL_ATTR
+uint32_t MDL_NAME(md5_finish)(const MD5_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                              int difficulty, uint8_t *digests) {
+    return MDL_NAME(md_finish)(MD_LANES_MD5, mid->state, mid->count, mid->buffer, tails, tail_len, 0, difficulty,
+                               digests);
+}
+
+MDL_ATTR
+uint32_t MDL_NAME(nt_finish)(const NT_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                             int difficulty, uint8_t *digests) {
+    const MD4_CTX *md4 = &mid->md4;
+    return MDL_NAME(md_finish)(MD_LANES_MD4, md4->state, md4->count, md4->buffer, tails,
+                               nt_tail_chars(mid, tail_len), 1, difficulty, digests);
+}
+
+MDL_ATTR
+uint32_t MDL_NAME(ripemd160_finish)(const RIPEMD160_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                    int difficulty, uint8_t *digests) {
+    return MDL_NAME(md_finish)(MD_LANES_RIPEMD160, mid->state, mid->count, mid->buffer, tails, tail_len, 0,
+                               difficulty, digests);
+}
+
+// RIPEMD-128/256/320 count bytes in one 64-bit word
+#define MDL_RIPEMD_FINISH(bits, CTX)                                                                        \
+    MDL_ATTR                                                                                                \
+    uint32_t MDL_NAME(ripemd##bits##_finish)(const CTX *mid, const uint8_t *const *tails, size_t tail_len,  \
+                                             int difficulty, uint8_t *digests) {                            \
+        uint32_t count[2] = { (uint32_t)(mid->count << 3), (uint32_t)(mid->count >> 29) };                  \
+        return MDL_NAME(md_finish)(MD_LANES_RIPEMD##bits, mid->state, count, mid->buffer, tails, tail_len,  \
+                                   0, difficulty, digests);                                                 \
+    }
+
+MDL_RIPEMD_FINISH(128, RIPEMD128_CTX)
+MDL_RIPEMD_FINISH(256, RIPEMD256_CTX)
+MDL_RIPEMD_FINISH(320, RIPEMD320_CTX)
+
+#undef MDL_RIPEMD_FINISH
+#undef V
+#undef MDL_LANES
+#undef MDL_ATTR
+#undef MDL_NAME
+#undef MDL_ZERO_LANES
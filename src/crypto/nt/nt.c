@@ -25,3 +25,33 @@ void nt_hash(const char *password, uint8_t digest[NT_HASH_LENGTH]) {
     
     nt_hash_unicode(utf16, len * 2, digest);
 }
+
+void nt_init(NT_CTX *ctx) {
+    md4_init(&ctx->md4);
+    ctx->chars = 0;
+    ctx->done = 0;
+}
+
+void nt_update(NT_CTX *ctx, const uint8_t *data, size_t len) {
+    uint8_t utf16[128];
+    size_t n = 0;
+
+    for (size_t i = 0; i < len && !ctx->done; i++) {
+        if (data[i] == 0 || ctx->chars == 256) {
+            ctx->done = 1;
+            break;
+        }
+        utf16[n++] = data[i];
+        utf16[n++] = 0;
+        ctx->chars++;
+        if (n == sizeof(utf16)) {
+            md4_update(&ctx->md4, utf16, n);
+            n = 0;
+        }
+    }
+    if (n > 0) md4_update(&ctx->md4, utf16, n);
+}
+
+void nt_final(uint8_t digest[NT_HASH_LENGTH], NT_CTX *ctx) {
+    md4_final(digest, &ctx->md4);
+}
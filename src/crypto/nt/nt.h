@@ -3,11 +3,24 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "../md4/md4.h"
 
 #define NT_HASH_LENGTH 16
 
+/* Streaming NT context: widens bytes to UTF-16LE on the fly and, like
+ * nt_hash, stops at the first NUL byte and after 256 characters */
+typedef struct {
+    MD4_CTX md4;
+    size_t chars;
+    int done;
+} NT_CTX;
+
 /* NT Hash (NTLM Hash) - Windows password hash using MD4 */
 void nt_hash(const char *password, uint8_t digest[NT_HASH_LENGTH]);
 void nt_hash_unicode(const uint8_t *password_utf16le, size_t len, uint8_t digest[NT_HASH_LENGTH]);
 
+void nt_init(NT_CTX *ctx);
+void nt_update(NT_CTX *ctx, const uint8_t *data, size_t len);
+void nt_final(uint8_t digest[NT_HASH_LENGTH], NT_CTX *ctx);
+
 #endif /* NT_HASH_H */
@@ -0,0 +1,597 @@
+/*
+ * Hash algorithm registry - descriptor table, thin state adapters and
+ * runtime backend selection
+ */
+
+#include "hash_registry.h"
+#include <stdatomic.h>
+
+/* Adapters from the per-algorithm APIs to the HashState signatures */
+#define HASH_STATE_OPS(tag, init_stmt, update_stmt, final_stmt)                       \
+    static void tag##_st_init(HashState *st) { init_stmt; }                           \
+    static void tag##_st_update(HashState *st, const uint8_t *data, size_t len) {     \
+        update_stmt;                                                                  \
+    }                                                                                 \
+    static void tag##_st_final(HashState *st, uint8_t *digest) { final_stmt; }
+
+HASH_STATE_OPS(md2, md2_init(&st->md2), md2_update(&st->md2, data, len), md2_final(digest, &st->md2))
+HASH_STATE_OPS(md4, md4_init(&st->md4), md4_update(&st->md4, data, len), md4_final(digest, &st->md4))
+HASH_STATE_OPS(md5, md5_init(&st->md5), md5_update(&st->md5, data, len), md5_final(digest, &st->md5))
+HASH_STATE_OPS(nt, nt_init(&st->nt), nt_update(&st->nt, data, len), nt_final(digest, &st->nt))
+HASH_STATE_OPS(sha0, sha0_init(&st->sha0), sha0_update(&st->sha0, data, len), sha0_final(digest, &st->sha0))
+HASH_STATE_OPS(sha1, sha1_init(&st->sha1), sha1_update(&st->sha1, data, len), sha1_final(digest, &st->sha1))
+HASH_STATE_OPS(sha224, sha224_init(&st->sha224), sha224_update(&st->sha224, data, len),
+               sha224_final(&st->sha224, digest))
+HASH_STATE_OPS(sha256, sha256_init(&st->sha256), sha256_update(&st->sha256, data, len),
+               sha256_final(&st->sha256, digest))
+HASH_STATE_OPS(sha384, sha384_init(&st->sha512), sha512_update(&st->sha512, data, len),
+               sha384_final(digest, &st->sha512))
+HASH_STATE_OPS(sha512, sha512_init(&st->sha512), sha512_update(&st->sha512, data, len),
+               sha512_final(digest, &st->sha512))
+HASH_STATE_OPS(sha3_224, sha3_224_init(&st->sha3_224), sha3_224_update(&st->sha3_224, data, len),
+               sha3_224_final(digest, &st->sha3_224))
+HASH_STATE_OPS(sha3_256, sha3_256_init(&st->sha3), sha3_update(&st->sha3, data, len),
+               sha3_final(digest, &st->sha3))
+HASH_STATE_OPS(sha3_384, sha3_384_init(&st->sha3_384), sha3_384_update(&st->sha3_384, data, len),
+               sha3_384_final(digest, &st->sha3_384))
+HASH_STATE_OPS(sha3_512, sha3_512_init(&st->sha3), sha3_update(&st->sha3, data, len),
+               sha3_final(digest, &st->sha3))
+HASH_STATE_OPS(keccak224, keccak_224_init(&st->keccak), keccak_update(&st->keccak, data, len),
+               keccak_final(digest, &st->keccak))
+HASH_STATE_OPS(keccak384, keccak_384_init(&st->keccak), keccak_update(&st->keccak, data, len),
+               keccak_final(digest, &st->keccak))
+HASH_STATE_OPS(keccak512, keccak_512_init(&st->keccak), keccak_update(&st->keccak, data, len),
+               keccak_final(digest, &st->keccak))
+HASH_STATE_OPS(shake128, shake128_init(&st->shake), shake_update(&st->shake, data, len),
+               shake_final(&st->shake); shake_squeeze(&st->shake, digest, 32))
+HASH_STATE_OPS(shake256, shake256_init(&st->shake), shake_update(&st->shake, data, len),
+               shake_final(&st->shake); shake_squeeze(&st->shake, digest, 64))
+HASH_STATE_OPS(ripemd128, ripemd128_init(&st->ripemd128), ripemd128_update(&st->ripemd128, data, len),
+               ripemd128_final(digest, &st->ripemd128))
+HASH_STATE_OPS(ripemd160, ripemd160_init(&st->ripemd160), ripemd160_update(&st->ripemd160, data, len),
+               ripemd160_final(digest, &st->ripemd160))
+HASH_STATE_OPS(ripemd256, ripemd256_init(&st->ripemd256), ripemd256_update(&st->ripemd256, data, len),
+               ripemd256_final(digest, &st->ripemd256))
+HASH_STATE_OPS(ripemd320, ripemd320_init(&st->ripemd320), ripemd320_update(&st->ripemd320, data, len),
+               ripemd320_final(digest, &st->ripemd320))
+HASH_STATE_OPS(blake2b_128, blake2b_init(&st->blake2b, 16), blake2b_update(&st->blake2b, data, len),
+               blake2b_final(&st->blake2b, digest, 16))
+HASH_STATE_OPS(blake2b_160, blake2b_init(&st->blake2b, 20), blake2b_update(&st->blake2b, data, len),
+               blake2b_final(&st->blake2b, digest, 20))
+HASH_STATE_OPS(blake2b_256, blake2b_init(&st->blake2b, 32), blake2b_update(&st->blake2b, data, len),
+               blake2b_final(&st->blake2b, digest, 32))
+HASH_STATE_OPS(blake2b_384, blake2b_init(&st->blake2b, 48), blake2b_update(&st->blake2b, data, len),
+               blake2b_final(&st->blake2b, digest, 48))
+HASH_STATE_OPS(blake2b_512, blake2b_init(&st->blake2b, 64), blake2b_update(&st->blake2b, data, len),
+               blake2b_final(&st->blake2b, digest, 64))
+HASH_STATE_OPS(blake2s_128, blake2s_init(&st->blake2s, 16), blake2s_update(&st->blake2s, data, len),
+               blake2s_final(&st->blake2s, digest, 16))
+HASH_STATE_OPS(blake2s_160, blake2s_init(&st->blake2s, 20), blake2s_update(&st->blake2s, data, len),
+               blake2s_final(&st->blake2s, digest, 20))
+HASH_STATE_OPS(blake2s_256, blake2s_init(&st->blake2s, 32), blake2s_update(&st->blake2s, data, len),
+               blake2s_final(&st->blake2s, digest, 32))
+HASH_STATE_OPS(blake2bp_512, blake2bp_init(&st->blake2bp, 64), blake2bp_update(&st->blake2bp, data, len),
+               blake2bp_final(&st->blake2bp, digest, 64))
+HASH_STATE_OPS(blake2sp_256, blake2sp_init(&st->blake2sp, 32), blake2sp_update(&st->blake2sp, data, len),
+               blake2sp_final(&st->blake2sp, digest, 32))
+HASH_STATE_OPS(whirlpool, whirlpool_init(&st->whirlpool), whirlpool_update(&st->whirlpool, data, len),
+               whirlpool_final(digest, &st->whirlpool))
+HASH_STATE_OPS(whirlpool0, whirlpool0_init(&st->whirlpool), whirlpool_update(&st->whirlpool, data, len),
+               whirlpool_final(digest, &st->whirlpool))
+HASH_STATE_OPS(whirlpoolt, whirlpoolt_init(&st->whirlpool), whirlpool_update(&st->whirlpool, data, len),
+               whirlpool_final(digest, &st->whirlpool))
+HASH_STATE_OPS(has160, has160_init(&st->has160), has160_update(&st->has160, data, len),
+               has160_final(digest, &st->has160))
+
+/* Keccak-256 shares SHA3_CTX and sha3_update with SHA3-256 */
+HASH_STATE_OPS(keccak256, keccak_256_init(&st->sha3), sha3_update(&st->sha3, data, len),
+               keccak_256_final(digest, &st->sha3))
+
+/*
+ * Search finalizers (hash_final_zeros_fn). The digest is a run of state
+ * words, big-endian for SHA-1/SHA-2 and little-endian for MD4/MD5/BLAKE2:
+ * whole words are tested as they stand and only the boundary word needs its
+ * byte order. Passing states are serialized here; failing ones never are.
+ */
+static inline uint32_t state_order32(uint32_t w, int be) {
+    return be ? w : (w << 24) | ((w & 0xff00) << 8) | ((w >> 8) & 0xff00) | (w >> 24);
+}
+
+static inline uint64_t state_order64(uint64_t w, int be) {
+    return be ? w : ((uint64_t)state_order32((uint32_t)w, 0) << 32) | state_order32((uint32_t)(w >> 32), 0);
+}
+
+static int state_zeros32(const uint32_t *w, int be, int size, int difficulty, uint8_t *digest) {
+    int i = 0;
+
+    if (difficulty > size * 8) return 0;
+    for (; difficulty - 32 * i >= 32; i++) {
+        if (w[i]) return 0;
+    }
+    int rest = difficulty - 32 * i;
+    if (rest > 0 && (state_order32(w[i], be) >> (32 - rest))) return 0;
+
+    for (int j = 0; j < size; j++) {
+        int shift = be ? 24 - 8 * (j % 4) : 8 * (j % 4);
+        digest[j] = (uint8_t)(w[j / 4] >> shift);
+    }
+    return 1;
+}
+
+static int state_zeros64(const uint64_t *w, int be, int size, int difficulty, uint8_t *digest) {
+    int i = 0;
+
+    if (difficulty > size * 8) return 0;
+    for (; difficulty - 64 * i >= 64; i++) {
+        if (w[i]) return 0;
+    }
+    int rest = difficulty - 64 * i;
+    if (rest > 0 && (state_order64(w[i], be) >> (64 - rest))) return 0;
+
+    for (int j = 0; j < size; j++) {
+        int shift = be ? 56 - 8 * (j % 8) : 8 * (j % 8);
+        digest[j] = (uint8_t)(w[j / 8] >> shift);
+    }
+    return 1;
+}
+
+#define HASH_FINAL_ZEROS(tag, finish_state, ctx, words, bits, be, size)                 \
+    static int tag##_st_final_zeros(HashState *st, int difficulty, uint8_t *digest) { \
+        finish_state(&st->ctx);                                                       \
+        return state_zeros##bits(st->ctx.words, (be), (size), difficulty, digest);    \
+    }
+
+HASH_FINAL_ZEROS(md4,         md4_final_state,     md4,     state, 32, 0, 16)
+HASH_FINAL_ZEROS(nt,          md4_final_state,     nt.md4,  state, 32, 0, 16)
+HASH_FINAL_ZEROS(md5,         md5_final_state,     md5,     state, 32, 0, 16)
+HASH_FINAL_ZEROS(sha1,        sha1_final_state,    sha1,    state, 32, 1, 20)
+HASH_FINAL_ZEROS(sha224,      sha224_final_state,  sha224,  state, 32, 1, 28)
+HASH_FINAL_ZEROS(sha256,      sha256_final_state,  sha256,  state, 32, 1, 32)
+HASH_FINAL_ZEROS(sha384,      sha512_final_state,  sha512,  state, 64, 1, 48)
+HASH_FINAL_ZEROS(sha512,      sha512_final_state,  sha512,  state, 64, 1, 64)
+HASH_FINAL_ZEROS(blake2b_128, blake2b_final_state, blake2b, h,     64, 0, 16)
+HASH_FINAL_ZEROS(blake2b_160, blake2b_final_state, blake2b, h,     64, 0, 20)
+HASH_FINAL_ZEROS(blake2b_256, blake2b_final_state, blake2b, h,     64, 0, 32)
+HASH_FINAL_ZEROS(blake2b_384, blake2b_final_state, blake2b, h,     64, 0, 48)
+HASH_FINAL_ZEROS(blake2b_512, blake2b_final_state, blake2b, h,     64, 0, 64)
+HASH_FINAL_ZEROS(blake2s_128, blake2s_final_state, blake2s, h,     32, 0, 16)
+HASH_FINAL_ZEROS(blake2s_160, blake2s_final_state, blake2s, h,     32, 0, 20)
+HASH_FINAL_ZEROS(blake2s_256, blake2s_final_state, blake2s, h,     32, 0, 32)
+
+/* One-shot wrappers for the APIs that do not take (data, len, digest) */
+static void shake128_32_hash(const uint8_t *data, size_t len, uint8_t *digest) {
+    shake128_hash(data, len, digest, 32);
+}
+
+static void shake256_64_hash(const uint8_t *data, size_t len, uint8_t *digest) {
+    shake256_hash(data, len, digest, 64);
+}
+
+/* nt_hash needs a C string; the streaming form gives the same digest for
+ * (data, len) without reading past len */
+static void nt_bytes_hash(const uint8_t *data, size_t len, uint8_t *digest) {
+    NT_CTX ctx;
+    nt_init(&ctx);
+    nt_update(&ctx, data, len);
+    nt_final(digest, &ctx);
+}
+
+/* zeros: 1 if the algorithm has a search finalizer (HASH_FINAL_ZEROS) */
+#define HASH_ZEROS_0(tag) NULL
+#define HASH_ZEROS_1(tag) tag##_st_final_zeros
+#define HASH_ENTRY(id, name, digest_size, block_size, ctx_type, oneshot, tag, zeros)               \
+    [id] = { id, name, digest_size, block_size, sizeof(ctx_type), HASH_F_MIDSTATE,                 \
+             oneshot, tag##_st_init, tag##_st_update, tag##_st_final, HASH_ZEROS_##zeros(tag),     \
+             1, NULL, "scalar" }
+
+/* Portable implementations; always available */
+static const HashDescriptor scalar_table[HASH_COUNT] = {
+    HASH_ENTRY(HASH_MD4,          "MD4",          16,  64, MD4_CTX,       md4_hash,          md4,          1),
+    HASH_ENTRY(HASH_NT,           "NT",           16,  64, NT_CTX,        nt_bytes_hash,     nt,           1),
+    HASH_ENTRY(HASH_MD5,          "MD5",          16,  64, MD5_CTX,       md5_hash,          md5,          1),
+    HASH_ENTRY(HASH_HAS160,       "HAS-160",      20,  64, HAS160_CTX,    has160_hash,       has160,       0),
+    HASH_ENTRY(HASH_RIPEMD256,    "RIPEMD-256",   32,  64, RIPEMD256_CTX, ripemd256_hash,    ripemd256,    0),
+    HASH_ENTRY(HASH_RIPEMD128,    "RIPEMD-128",   16,  64, RIPEMD128_CTX, ripemd128_hash,    ripemd128,    0),
+    HASH_ENTRY(HASH_BLAKE2S_128,  "BLAKE2s-128",  16,  64, BLAKE2S_CTX,   blake2s_128_hash,  blake2s_128,  1),
+    HASH_ENTRY(HASH_BLAKE2S_160,  "BLAKE2s-160",  20,  64, BLAKE2S_CTX,   blake2s_160_hash,  blake2s_160,  1),
+    HASH_ENTRY(HASH_BLAKE2S_256,  "BLAKE2s-256",  32,  64, BLAKE2S_CTX,   blake2s_256_hash,  blake2s_256,  1),
+    HASH_ENTRY(HASH_BLAKE2B_512,  "BLAKE2b-512",  64, 128, BLAKE2B_CTX,   blake2b_512_hash,  blake2b_512,  1),
+    HASH_ENTRY(HASH_RIPEMD320,    "RIPEMD-320",   40,  64, RIPEMD320_CTX, ripemd320_hash,    ripemd320,    0),
+    HASH_ENTRY(HASH_BLAKE2B_128,  "BLAKE2b-128",  16, 128, BLAKE2B_CTX,   blake2b_128_hash,  blake2b_128,  1),
+    HASH_ENTRY(HASH_BLAKE2B_384,  "BLAKE2b-384",  48, 128, BLAKE2B_CTX,   blake2b_384_hash,  blake2b_384,  1),
+    HASH_ENTRY(HASH_RIPEMD160,    "RIPEMD-160",   20,  64, RIPEMD160_CTX, ripemd160_hash,    ripemd160,    0),
+    HASH_ENTRY(HASH_BLAKE2B_160,  "BLAKE2b-160",  20, 128, BLAKE2B_CTX,   blake2b_160_hash,  blake2b_160,  1),
+    HASH_ENTRY(HASH_BLAKE2B_256,  "BLAKE2b-256",  32, 128, BLAKE2B_CTX,   blake2b_256_hash,  blake2b_256,  1),
+    HASH_ENTRY(HASH_SHA256,       "SHA2-256",     32,  64, SHA256_CTX,    sha256,            sha256,       1),
+    HASH_ENTRY(HASH_SHA0,         "SHA-0",        20,  64, SHA0_CTX,      sha0_hash,         sha0,         0),
+    HASH_ENTRY(HASH_SHA1,         "SHA-1",        20,  64, SHA1_CTX,      sha1_hash,         sha1,         1),
+    HASH_ENTRY(HASH_SHA224,       "SHA2-224",     28,  64, SHA224_CTX,    sha224_hash,       sha224,       1),
+    HASH_ENTRY(HASH_SHA512,       "SHA2-512",     64, 128, SHA512_CTX,    sha512_hash,       sha512,       1),
+    HASH_ENTRY(HASH_SHA384,       "SHA2-384",     48, 128, SHA512_CTX,    sha384_hash,       sha384,       1),
+    HASH_ENTRY(HASH_WHIRLPOOL,    "Whirlpool",    64,  64, WHIRLPOOL_CTX, whirlpool_hash,    whirlpool,    0),
+    HASH_ENTRY(HASH_SHA3_224,     "SHA3-224",     28, 144, SHA3_224_CTX,  sha3_224_hash,     sha3_224,     0),
+    HASH_ENTRY(HASH_SHAKE256,     "SHAKE-256",    64, 136, SHAKE_CTX,     shake256_64_hash,  shake256,     0),
+    HASH_ENTRY(HASH_SHA3_384,     "SHA3-384",     48, 104, SHA3_384_CTX,  sha3_384_hash,     sha3_384,     0),
+    HASH_ENTRY(HASH_SHAKE128,     "SHAKE-128",    32, 168, SHAKE_CTX,     shake128_32_hash,  shake128,     0),
+    HASH_ENTRY(HASH_KECCAK384,    "Keccak-384",   48, 104, KECCAK_CTX,    keccak_384_hash,   keccak384,    0),
+    HASH_ENTRY(HASH_KECCAK256,    "Keccak-256",   32, 136, SHA3_CTX,      keccak_256_hash,   keccak256,    0),
+    HASH_ENTRY(HASH_SHA3_256,     "SHA3-256",     32, 136, SHA3_CTX,      sha3_256_hash,     sha3_256,     0),
+    HASH_ENTRY(HASH_SHA3_512,     "SHA3-512",     64,  72, SHA3_CTX,      sha3_512_hash,     sha3_512,     0),
+    HASH_ENTRY(HASH_KECCAK512,    "Keccak-512",   64,  72, KECCAK_CTX,    keccak_512_hash,   keccak512,    0),
+    HASH_ENTRY(HASH_KECCAK224,    "Keccak-224",   28, 144, KECCAK_CTX,    keccak_224_hash,   keccak224,    0),
+    HASH_ENTRY(HASH_MD2,          "MD2",          16,  16, MD2_CTX,       md2_hash,          md2,          0),
+    HASH_ENTRY(HASH_BLAKE2BP_512, "BLAKE2bp-512", 64, 128, BLAKE2BP_CTX,  blake2bp_512_hash, blake2bp_512, 0),
+    HASH_ENTRY(HASH_BLAKE2SP_256, "BLAKE2sp-256", 32,  64, BLAKE2SP_CTX,  blake2sp_256_hash, blake2sp_256, 0),
+    HASH_ENTRY(HASH_WHIRLPOOL0,   "Whirlpool-0",  64,  64, WHIRLPOOL_CTX, whirlpool0_hash,   whirlpool0,   0),
+    HASH_ENTRY(HASH_WHIRLPOOLT,   "Whirlpool-T",  64,  64, WHIRLPOOL_CTX, whirlpoolt_hash,   whirlpoolt,   0),
+};
+
+/*
+ * Module-wide kernels a backend can swap in (block compression, tree-mode
+ * leaf stripes). Backends fill a copy that is installed once selection is
+ * done, so a pointer never drops back to the portable code on its way from
+ * one accelerated kernel to another.
+ */
+typedef struct {
+    sha256_compress_fn sha256;
+    sha1_compress_fn sha1;
+    sha0_compress_fn sha0;
+    blake2b_compress_fn blake2b;
+    blake2s_compress_fn blake2s;
+    blake2bp_stripes_fn blake2bp;
+    blake2sp_stripes_fn blake2sp;
+    whirlpool_compress_fn whirlpool;
+} HashKernels;
+
+/*
+ * ISA-specific backends. Each entry patches the descriptor of one algorithm
+ * and/or the kernels when every feature it needs is present; entries are
+ * ordered from least to most preferred and applied in turn, so later matches
+ * override earlier ones (and name the backend).
+ */
+typedef struct {
+    HashAlgorithm algo;
+    const char *name;
+    uint32_t features;
+    void (*apply)(HashDescriptor *d, HashKernels *k);
+} HashBackend;
+
+#if defined(CPU_X86_KERNELS)
+// SHA-1/SHA-0/SHA-2 swap the block compression inside the module, so the
+// streaming, midstate and one-shot entry points all pick it up
+static void use_sha256_shani(HashDescriptor *d, HashKernels *k) {
+    k->sha256 = sha256_transform_shani;
+    d->lanes = 1;               // on par with the 8-lane AVX2 search, so drop it
+    d->finish_lanes = NULL;
+}
+static void use_sha1_shani(HashDescriptor *d, HashKernels *k) { (void)d; k->sha1 = sha1_transform_shani; }
+static void use_sha0_shani(HashDescriptor *d, HashKernels *k) { (void)d; k->sha0 = sha0_transform_shani; }
+static void use_blake2b_avx2(HashDescriptor *d, HashKernels *k) { (void)d; k->blake2b = blake2b_compress_avx2; }
+static void use_blake2s_ssse3(HashDescriptor *d, HashKernels *k) { (void)d; k->blake2s = blake2s_compress_ssse3; }
+static void use_blake2bp_avx2(HashDescriptor *d, HashKernels *k) { (void)d; k->blake2bp = blake2b_stripes_x4_avx2; }
+static void use_blake2sp_sse2(HashDescriptor *d, HashKernels *k) { (void)d; k->blake2sp = blake2s_stripes_x4_sse2; }
+static void use_blake2sp_avx2(HashDescriptor *d, HashKernels *k) { (void)d; k->blake2sp = blake2s_stripes_x8_avx2; }
+static void use_whirlpool_gfni(HashDescriptor *d, HashKernels *k) { (void)d; k->whirlpool = whirlpool_compress_gfni; }
+#define WHIRLPOOL_GFNI (CPU_AVX512F | CPU_AVX512BW | CPU_AVX512VBMI | CPU_GFNI)
+#endif
+
+#if defined(CPU_X86_KERNELS) || defined(CPU_ARM64_KERNELS)
+// Adapter from a module's lane kernel to hash_lanes_fn, and the backend
+// hook that installs it with its lane count
+#define LANES_BACKEND(tag, kernel, field, n)                                                         \
+    static uint32_t tag##_lanes(const HashState *mid, const uint8_t *const *tails, size_t tail_len,  \
+                                int difficulty, uint8_t *digests) {                                  \
+        return kernel(&mid->field, tails, tail_len, difficulty, digests);                            \
+    }                                                                                                \
+    static void use_##tag(HashDescriptor *d, HashKernels *k) {                                       \
+        (void)k;                                                                                     \
+        d->lanes = (n);                                                                              \
+        d->finish_lanes = tag##_lanes;                                                               \
+    }
+#endif
+
+#if defined(CPU_X86_KERNELS)
+LANES_BACKEND(sha256_avx2,   sha256_finish_x8_avx2,    sha256, 8)
+LANES_BACKEND(sha256_avx512, sha256_finish_x16_avx512, sha256, 16)
+LANES_BACKEND(sha512_avx2,   sha512_finish_x4_avx2,    sha512, 4)
+LANES_BACKEND(sha512_avx512, sha512_finish_x8_avx512,  sha512, 8)
+LANES_BACKEND(sha384_avx2,   sha384_finish_x4_avx2,    sha512, 4)
+LANES_BACKEND(sha384_avx512, sha384_finish_x8_avx512,  sha512, 8)
+LANES_BACKEND(md4_sse2,      md4_finish_x4_sse2,       md4, 4)
+LANES_BACKEND(md4_avx2,      md4_finish_x8_avx2,       md4, 8)
+LANES_BACKEND(md4_avx512,    md4_finish_x16_avx512,    md4, 16)
+LANES_BACKEND(nt_sse2,       nt_finish_x4_sse2,        nt, 4)
+LANES_BACKEND(nt_avx2,       nt_finish_x8_avx2,        nt, 8)
+LANES_BACKEND(nt_avx512,     nt_finish_x16_avx512,     nt, 16)
+LANES_BACKEND(md5_sse2,      md5_finish_x4_sse2,       md5, 4)
+LANES_BACKEND(md5_avx2,      md5_finish_x8_avx2,       md5, 8)
+LANES_BACKEND(md5_avx512,    md5_finish_x16_avx512,    md5, 16)
+LANES_BACKEND(ripemd128_sse2,   ripemd128_finish_x4_sse2,     ripemd128, 4)
+LANES_BACKEND(ripemd128_avx2,   ripemd128_finish_x8_avx2,     ripemd128, 8)
+LANES_BACKEND(ripemd128_avx512, ripemd128_finish_x16_avx512,  ripemd128, 16)
+LANES_BACKEND(ripemd160_sse2,   ripemd160_finish_x4_sse2,     ripemd160, 4)
+LANES_BACKEND(ripemd160_avx2,   ripemd160_finish_x8_avx2,     ripemd160, 8)
+LANES_BACKEND(ripemd160_avx512, ripemd160_finish_x16_avx512,  ripemd160, 16)
+LANES_BACKEND(ripemd256_sse2,   ripemd256_finish_x4_sse2,     ripemd256, 4)
+LANES_BACKEND(ripemd256_avx2,   ripemd256_finish_x8_avx2,     ripemd256, 8)
+LANES_BACKEND(ripemd256_avx512, ripemd256_finish_x16_avx512,  ripemd256, 16)
+LANES_BACKEND(ripemd320_sse2,   ripemd320_finish_x4_sse2,     ripemd320, 4)
+LANES_BACKEND(ripemd320_avx2,   ripemd320_finish_x8_avx2,     ripemd320, 8)
+LANES_BACKEND(ripemd320_avx512, ripemd320_finish_x16_avx512,  ripemd320, 16)
+LANES_BACKEND(blake2b_avx2x4,    blake2b_finish_x4_avx2,    blake2b, 4)
+LANES_BACKEND(blake2b_avx512x8,  blake2b_finish_x8_avx512,  blake2b, 8)
+LANES_BACKEND(blake2s_sse2x4,    blake2s_finish_x4_sse2,    blake2s, 4)
+LANES_BACKEND(blake2s_avx2x8,    blake2s_finish_x8_avx2,    blake2s, 8)
+LANES_BACKEND(blake2s_avx512x16, blake2s_finish_x16_avx512, blake2s, 16)
+LANES_BACKEND(whirlpool_gfnix4,  whirlpool_finish_x4_gfni,  whirlpool, 4)
+
+// The sponge kernels are shared by all ten Keccak-based algorithms, which
+// differ only in their context, padding byte and output length
+#define KECCAK_LANES_BACKEND(tag, kernel, field, domain, out_len, n)                                  \
+    static uint32_t tag##_lanes(const HashState *mid, const uint8_t *const *tails, size_t tail_len,  \
+                                int difficulty, uint8_t *digests) {                                  \
+        return kernel(mid->field.state, mid->field.buffer, mid->field.buf_len, mid->field.rate,      \
+                      (domain), (out_len), tails, tail_len, difficulty, digests);                    \
+    }                                                                                                \
+    static void use_##tag(HashDescriptor *d, HashKernels *k) {                                       \
+        (void)k;                                                                                     \
+        d->lanes = (n);                                                                              \
+        d->finish_lanes = tag##_lanes;                                                               \
+    }
+#define KECCAK_LANES(tag, field, domain, out_len)                                             \
+    KECCAK_LANES_BACKEND(tag##_avx2, keccak_finish_x4_avx2, field, domain, out_len, 4)        \
+    KECCAK_LANES_BACKEND(tag##_avx512, keccak_finish_x8_avx512, field, domain, out_len, 8)
+
+KECCAK_LANES(sha3_224,  sha3_224, KECCAK_DOMAIN_SHA3,   28)
+KECCAK_LANES(sha3_256,  sha3,     KECCAK_DOMAIN_SHA3,   32)
+KECCAK_LANES(sha3_384,  sha3_384, KECCAK_DOMAIN_SHA3,   48)
+KECCAK_LANES(sha3_512,  sha3,     KECCAK_DOMAIN_SHA3,   64)
+KECCAK_LANES(keccak224, keccak,   KECCAK_DOMAIN_KECCAK, 28)
+KECCAK_LANES(keccak256, sha3,     KECCAK_DOMAIN_KECCAK, 32)
+KECCAK_LANES(keccak384, keccak,   KECCAK_DOMAIN_KECCAK, 48)
+KECCAK_LANES(keccak512, keccak,   KECCAK_DOMAIN_KECCAK, 64)
+KECCAK_LANES(shake128,  shake,    KECCAK_DOMAIN_SHAKE,  32)
+KECCAK_LANES(shake256,  shake,    KECCAK_DOMAIN_SHAKE,  64)
+#endif
+
+#if defined(CPU_ARM64_KERNELS)
+LANES_BACKEND(md4_neon, md4_finish_x4_neon, md4, 4)
+LANES_BACKEND(nt_neon,  nt_finish_x4_neon,  nt, 4)
+LANES_BACKEND(md5_neon, md5_finish_x4_neon, md5, 4)
+LANES_BACKEND(ripemd128_neon, ripemd128_finish_x4_neon, ripemd128, 4)
+LANES_BACKEND(ripemd160_neon, ripemd160_finish_x4_neon, ripemd160, 4)
+LANES_BACKEND(ripemd256_neon, ripemd256_finish_x4_neon, ripemd256, 4)
+LANES_BACKEND(ripemd320_neon, ripemd320_finish_x4_neon, ripemd320, 4)
+LANES_BACKEND(blake2s_neonx4, blake2s_finish_x4_neon, blake2s, 4)
+static void use_blake2sp_neon(HashDescriptor *d, HashKernels *k) { (void)d; k->blake2sp = blake2s_stripes_x4_neon; }
+#endif
+
+static const HashBackend hash_backends[] = {
+#if defined(CPU_X86_KERNELS)
+    { HASH_MD4,          "sse2x4",    CPU_SSE2,            use_md4_sse2 },
+    { HASH_MD4,          "avx2x8",    CPU_AVX2,            use_md4_avx2 },
+    { HASH_MD4,          "avx512x16", CPU_AVX512F,         use_md4_avx512 },
+    { HASH_NT,           "sse2x4",    CPU_SSE2,            use_nt_sse2 },
+    { HASH_NT,           "avx2x8",    CPU_AVX2,            use_nt_avx2 },
+    { HASH_NT,           "avx512x16", CPU_AVX512F,         use_nt_avx512 },
+    { HASH_MD5,          "sse2x4",    CPU_SSE2,            use_md5_sse2 },
+    { HASH_MD5,          "avx2x8",    CPU_AVX2,            use_md5_avx2 },
+    { HASH_MD5,          "avx512x16", CPU_AVX512F,         use_md5_avx512 },
+    { HASH_RIPEMD128,    "sse2x4",    CPU_SSE2,            use_ripemd128_sse2 },
+    { HASH_RIPEMD128,    "avx2x8",    CPU_AVX2,            use_ripemd128_avx2 },
+    { HASH_RIPEMD128,    "avx512x16", CPU_AVX512F,         use_ripemd128_avx512 },
+    { HASH_RIPEMD160,    "sse2x4",    CPU_SSE2,            use_ripemd160_sse2 },
+    { HASH_RIPEMD160,    "avx2x8",    CPU_AVX2,            use_ripemd160_avx2 },
+    { HASH_RIPEMD160,    "avx512x16", CPU_AVX512F,         use_ripemd160_avx512 },
+    { HASH_RIPEMD256,    "sse2x4",    CPU_SSE2,            use_ripemd256_sse2 },
+    { HASH_RIPEMD256,    "avx2x8",    CPU_AVX2,            use_ripemd256_avx2 },
+    { HASH_RIPEMD256,    "avx512x16", CPU_AVX512F,         use_ripemd256_avx512 },
+    { HASH_RIPEMD320,    "sse2x4",    CPU_SSE2,            use_ripemd320_sse2 },
+    { HASH_RIPEMD320,    "avx2x8",    CPU_AVX2,            use_ripemd320_avx2 },
+    { HASH_RIPEMD320,    "avx512x16", CPU_AVX512F,         use_ripemd320_avx512 },
+    { HASH_SHA256,       "avx2x8",    CPU_AVX2,            use_sha256_avx2 },
+    { HASH_SHA256,       "avx512x16", CPU_AVX512F,         use_sha256_avx512 },
+    { HASH_SHA256,       "sha-ni",    CPU_SHA | CPU_SSE41, use_sha256_shani },
+    { HASH_SHA224,       "sha-ni",    CPU_SHA | CPU_SSE41, use_sha256_shani },
+    { HASH_SHA512,       "avx2x4",    CPU_AVX2,            use_sha512_avx2 },
+    { HASH_SHA512,       "avx512x8",  CPU_AVX512F,         use_sha512_avx512 },
+    { HASH_SHA384,       "avx2x4",    CPU_AVX2,            use_sha384_avx2 },
+    { HASH_SHA384,       "avx512x8",  CPU_AVX512F,         use_sha384_avx512 },
+    { HASH_SHA1,         "sha-ni",    CPU_SHA | CPU_SSE41, use_sha1_shani },
+    { HASH_SHA0,         "sha-ni",    CPU_SHA | CPU_SSE41, use_sha0_shani },
+    // BLAKE2: the row-vectorized compression for streaming and one-shot
+    // hashing first, then the search kernels, which name the backend
+    { HASH_BLAKE2B_128,  "avx2",      CPU_AVX2,            use_blake2b_avx2 },
+    { HASH_BLAKE2B_128,  "avx2x4",    CPU_AVX2,            use_blake2b_avx2x4 },
+    { HASH_BLAKE2B_128,  "avx512x8",  CPU_AVX512F,         use_blake2b_avx512x8 },
+    { HASH_BLAKE2B_160,  "avx2",      CPU_AVX2,            use_blake2b_avx2 },
+    { HASH_BLAKE2B_160,  "avx2x4",    CPU_AVX2,            use_blake2b_avx2x4 },
+    { HASH_BLAKE2B_160,  "avx512x8",  CPU_AVX512F,         use_blake2b_avx512x8 },
+    { HASH_BLAKE2B_256,  "avx2",      CPU_AVX2,            use_blake2b_avx2 },
+    { HASH_BLAKE2B_256,  "avx2x4",    CPU_AVX2,            use_blake2b_avx2x4 },
+    { HASH_BLAKE2B_256,  "avx512x8",  CPU_AVX512F,         use_blake2b_avx512x8 },
+    { HASH_BLAKE2B_384,  "avx2",      CPU_AVX2,            use_blake2b_avx2 },
+    { HASH_BLAKE2B_384,  "avx2x4",    CPU_AVX2,            use_blake2b_avx2x4 },
+    { HASH_BLAKE2B_384,  "avx512x8",  CPU_AVX512F,         use_blake2b_avx512x8 },
+    { HASH_BLAKE2B_512,  "avx2",      CPU_AVX2,            use_blake2b_avx2 },
+    { HASH_BLAKE2B_512,  "avx2x4",    CPU_AVX2,            use_blake2b_avx2x4 },
+    { HASH_BLAKE2B_512,  "avx512x8",  CPU_AVX512F,         use_blake2b_avx512x8 },
+    { HASH_BLAKE2S_128,  "ssse3",     CPU_SSSE3,           use_blake2s_ssse3 },
+    { HASH_BLAKE2S_128,  "sse2x4",    CPU_SSE2,            use_blake2s_sse2x4 },
+    { HASH_BLAKE2S_128,  "avx2x8",    CPU_AVX2,            use_blake2s_avx2x8 },
+    { HASH_BLAKE2S_128,  "avx512x16", CPU_AVX512F,         use_blake2s_avx512x16 },
+    { HASH_BLAKE2S_160,  "ssse3",     CPU_SSSE3,           use_blake2s_ssse3 },
+    { HASH_BLAKE2S_160,  "sse2x4",    CPU_SSE2,            use_blake2s_sse2x4 },
+    { HASH_BLAKE2S_160,  "avx2x8",    CPU_AVX2,            use_blake2s_avx2x8 },
+    { HASH_BLAKE2S_160,  "avx512x16", CPU_AVX512F,         use_blake2s_avx512x16 },
+    { HASH_BLAKE2S_256,  "ssse3",     CPU_SSSE3,           use_blake2s_ssse3 },
+    { HASH_BLAKE2S_256,  "sse2x4",    CPU_SSE2,            use_blake2s_sse2x4 },
+    { HASH_BLAKE2S_256,  "avx2x8",    CPU_AVX2,            use_blake2s_avx2x8 },
+    { HASH_BLAKE2S_256,  "avx512x16", CPU_AVX512F,         use_blake2s_avx512x16 },
+    // BLAKE2bp / BLAKE2sp: the root and the leaves' final blocks use the
+    // row-vectorized compression, whole stripes the leaf kernels
+    { HASH_BLAKE2BP_512, "avx2",      CPU_AVX2,            use_blake2b_avx2 },
+    { HASH_BLAKE2BP_512, "avx2x4",    CPU_AVX2,            use_blake2bp_avx2 },
+    { HASH_BLAKE2SP_256, "ssse3",     CPU_SSSE3,           use_blake2s_ssse3 },
+    { HASH_BLAKE2SP_256, "sse2x4",    CPU_SSE2,            use_blake2sp_sse2 },
+    { HASH_BLAKE2SP_256, "avx2x8",    CPU_AVX2,            use_blake2sp_avx2 },
+    { HASH_SHA3_224,     "avx2x4",    CPU_AVX2,            use_sha3_224_avx2 },
+    { HASH_SHA3_224,     "avx512x8",  CPU_AVX512F,         use_sha3_224_avx512 },
+    { HASH_SHA3_256,     "avx2x4",    CPU_AVX2,            use_sha3_256_avx2 },
+    { HASH_SHA3_256,     "avx512x8",  CPU_AVX512F,         use_sha3_256_avx512 },
+    { HASH_SHA3_384,     "avx2x4",    CPU_AVX2,            use_sha3_384_avx2 },
+    { HASH_SHA3_384,     "avx512x8",  CPU_AVX512F,         use_sha3_384_avx512 },
+    { HASH_SHA3_512,     "avx2x4",    CPU_AVX2,            use_sha3_512_avx2 },
+    { HASH_SHA3_512,     "avx512x8",  CPU_AVX512F,         use_sha3_512_avx512 },
+    { HASH_KECCAK224,    "avx2x4",    CPU_AVX2,            use_keccak224_avx2 },
+    { HASH_KECCAK224,    "avx512x8",  CPU_AVX512F,         use_keccak224_avx512 },
+    { HASH_KECCAK256,    "avx2x4",    CPU_AVX2,            use_keccak256_avx2 },
+    { HASH_KECCAK256,    "avx512x8",  CPU_AVX512F,         use_keccak256_avx512 },
+    { HASH_KECCAK384,    "avx2x4",    CPU_AVX2,            use_keccak384_avx2 },
+    { HASH_KECCAK384,    "avx512x8",  CPU_AVX512F,         use_keccak384_avx512 },
+    { HASH_KECCAK512,    "avx2x4",    CPU_AVX2,            use_keccak512_avx2 },
+    { HASH_KECCAK512,    "avx512x8",  CPU_AVX512F,         use_keccak512_avx512 },
+    { HASH_SHAKE128,     "avx2x4",    CPU_AVX2,            use_shake128_avx2 },
+    { HASH_SHAKE128,     "avx512x8",  CPU_AVX512F,         use_shake128_avx512 },
+    { HASH_SHAKE256,     "avx2x4",    CPU_AVX2,            use_shake256_avx2 },
+    { HASH_SHAKE256,     "avx512x8",  CPU_AVX512F,         use_shake256_avx512 },
+    // Whirlpool: all three variants share the kernels, which read the
+    // variant from the context
+    { HASH_WHIRLPOOL,    "gfni",      WHIRLPOOL_GFNI,      use_whirlpool_gfni },
+    { HASH_WHIRLPOOL,    "gfnix4",    WHIRLPOOL_GFNI,      use_whirlpool_gfnix4 },
+    { HASH_WHIRLPOOL0,   "gfni",      WHIRLPOOL_GFNI,      use_whirlpool_gfni },
+    { HASH_WHIRLPOOL0,   "gfnix4",    WHIRLPOOL_GFNI,      use_whirlpool_gfnix4 },
+    { HASH_WHIRLPOOLT,   "gfni",      WHIRLPOOL_GFNI,      use_whirlpool_gfni },
+    { HASH_WHIRLPOOLT,   "gfnix4",    WHIRLPOOL_GFNI,      use_whirlpool_gfnix4 },
+    // 16 lanes still search about twice as fast as one SHA-NI stream
+    { HASH_SHA256, "sha-ni+avx512x16", CPU_SHA | CPU_SSE41 | CPU_AVX512F, use_sha256_avx512 },
+#endif
+#if defined(CPU_ARM64_KERNELS)
+    { HASH_MD4,          "neonx4",    CPU_NEON,            use_md4_neon },
+    { HASH_NT,           "neonx4",    CPU_NEON,            use_nt_neon },
+    { HASH_MD5,          "neonx4",    CPU_NEON,            use_md5_neon },
+    { HASH_RIPEMD128,    "neonx4",    CPU_NEON,            use_ripemd128_neon },
+    { HASH_RIPEMD160,    "neonx4",    CPU_NEON,            use_ripemd160_neon },
+    { HASH_RIPEMD256,    "neonx4",    CPU_NEON,            use_ripemd256_neon },
+    { HASH_RIPEMD320,    "neonx4",    CPU_NEON,            use_ripemd320_neon },
+    { HASH_BLAKE2S_128,  "neonx4",    CPU_NEON,            use_blake2s_neonx4 },
+    { HASH_BLAKE2S_160,  "neonx4",    CPU_NEON,            use_blake2s_neonx4 },
+    { HASH_BLAKE2S_256,  "neonx4",    CPU_NEON,            use_blake2s_neonx4 },
+    { HASH_BLAKE2SP_256, "neonx4",    CPU_NEON,            use_blake2sp_neon },
+#endif
+    { HASH_COUNT, NULL, 0, NULL }
+};
+
+/*
+ * Two tables: selection fills the one not in use and publishes it with a
+ * release store, and readers take it with an acquire load, so a reader sees
+ * the previous table or the complete new one, never a mix of scalar and SIMD
+ * fields. Selections are serialized by a spin lock; they take microseconds
+ * and only happen on first use and on hash_registry_force.
+ */
+static HashDescriptor hash_tables[2][HASH_COUNT];
+static _Atomic(const HashDescriptor *) hash_table = NULL;
+static atomic_flag hash_select_lock = ATOMIC_FLAG_INIT;
+static atomic_uint hash_generation;     // tables published so far
+
+// Select backends for the current CPU feature mask, after restricting it to
+// *force_mask if given; without one, only the first call does any work
+static const HashDescriptor *hash_registry_select(const uint32_t *force_mask) {
+    while (atomic_flag_test_and_set_explicit(&hash_select_lock, memory_order_acquire)) {}
+
+    const HashDescriptor *active = atomic_load_explicit(&hash_table, memory_order_relaxed);
+    if (!active || force_mask) {
+        if (force_mask) cpu_features_force(*force_mask);
+        uint32_t features = cpu_features();
+        HashDescriptor *next = hash_tables[active == hash_tables[0]];
+        HashKernels k = {
+            sha256_transform_fast, sha1_transform_generic, sha0_transform_generic,
+            blake2b_compress_generic, blake2s_compress_generic,
+            blake2bp_stripes_generic, blake2sp_stripes_generic, whirlpool_compress_generic,
+        };
+
+        memcpy(next, scalar_table, sizeof(hash_tables[0]));
+        for (const HashBackend *b = hash_backends; b->algo != HASH_COUNT; b++) {
+            if ((features & b->features) != b->features) continue;
+            b->apply(&next[b->algo], &k);
+            next[b->algo].backend = b->name;
+        }
+
+        // Every kernel is a drop-in for the portable one, so a thread already
+        // hashing may switch mid-message; the release below orders these
+        // stores before the table for threads that go through hash_descriptor
+        sha256_compress = k.sha256;
+        sha1_compress = k.sha1;
+        sha0_compress = k.sha0;
+        blake2b_compress = k.blake2b;
+        blake2s_compress = k.blake2s;
+        blake2bp_stripes = k.blake2bp;
+        blake2sp_stripes = k.blake2sp;
+        whirlpool_compress = k.whirlpool;
+        atomic_store_explicit(&hash_table, next, memory_order_release);
+        atomic_fetch_add_explicit(&hash_generation, 1, memory_order_release);
+        active = next;
+    }
+
+    atomic_flag_clear_explicit(&hash_select_lock, memory_order_release);
+    return active;
+}
+
+uint32_t hash_registry_force(uint32_t mask) {
+    hash_registry_select(&mask);
+    return cpu_features();
+}
+
+unsigned hash_registry_generation(void) {
+    return atomic_load_explicit(&hash_generation, memory_order_acquire);
+}
+
+const HashDescriptor *hash_descriptor(HashAlgorithm algo) {
+    if ((int)algo < 0 || algo >= HASH_COUNT) return NULL;
+    const HashDescriptor *table = atomic_load_explicit(&hash_table, memory_order_acquire);
+    if (!table) table = hash_registry_select(NULL);
+    return &table[algo];
+}
+
+int hash_algo_by_name(const char *name) {
+    if (!name) return -1;
+    if (strcmp(name, "SHA256") == 0) return HASH_SHA256;
+    if (strcmp(name, "SHA1") == 0) return HASH_SHA1;
+    for (int i = 0; i < HASH_COUNT; i++) {
+        if (strcmp(name, scalar_table[i].name) == 0) return i;
+    }
+    return -1;
+}
+
+// Bytes of input all states take before the next slice is read
+#define HASH_MULTI_SLICE 4096
+
+void hash_multi_update(const HashDescriptor *const *descs, HashState *states, int n, const uint8_t *data,
+                       size_t len) {
+    for (size_t start = 0; start < len; start += HASH_MULTI_SLICE) {
+        size_t end = len - start > HASH_MULTI_SLICE ? start + HASH_MULTI_SLICE : len;
+
+        // Each state's share ends on its own block boundary, so a state
+        // that starts block-aligned (64-byte MD/SHA/RIPEMD, 72..168-byte
+        // Keccak rates) compresses straight from the input and never
+        // buffers a partial block; the last slice takes the rest
+        for (int i = 0; i < n; i++) {
+            size_t block = (size_t)descs[i]->block_size;
+            size_t from = start - start % block;
+            size_t to = end == len ? len : end - end % block;
+            if (to > from) descs[i]->update(&states[i], data + from, to - from);
+        }
+    }
+}
+
+void hash_midstates(const HashDescriptor *const *descs, HashState *mids, int n, const uint8_t *prefix, size_t len) {
+    for (int i = 0; i < n; i++) descs[i]->init(&mids[i]);
+    hash_multi_update(descs, mids, n, prefix, len);
+}
+
+int hash_compute(HashAlgorithm algo, const uint8_t *data, size_t len, uint8_t *digest) {
+    const HashDescriptor *d = hash_descriptor(algo);
+    if (!d) return 0;
+    d->hash(data, len, digest);
+    return d->digest_size;
+}
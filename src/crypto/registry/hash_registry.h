@@ -0,0 +1,214 @@
+#ifndef HASH_REGISTRY_H
+#define HASH_REGISTRY_H
+
+/*
+ * Hash algorithm registry
+ *
+ * One descriptor per algorithm with its sizes and entry points. The client,
+ * the server and the benchmark all dispatch through this table; callers
+ * look a descriptor up once and then call through its function pointers,
+ * so per-hash work has no switch and no digest memset.
+ *
+ * The table starts from the portable implementations; on first use each
+ * algorithm is switched to the best backend the CPU supports (see
+ * hash_backends in hash_registry.c and cpu/cpu_features.h).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "../md2/md2.h"
+#include "../md4/md4.h"
+#include "../md5/md5.h"
+#include "../sha0/sha0.h"
+#include "../sha1/sha1.h"
+#include "../sha224/sha224.h"
+#include "../sha256/sha256.h"
+#include "../sha512/sha512.h"
+#include "../sha3/sha3.h"
+#include "../sha3_224/sha3_224.h"
+#include "../sha3_384/sha3_384.h"
+#include "../keccak/keccak.h"
+#include "../shake/shake.h"
+#include "../ripemd/ripemd160.h"
+#include "../ripemd128/ripemd128.h"
+#include "../ripemd256/ripemd256.h"
+#include "../ripemd320/ripemd320.h"
+#include "../blake2b/blake2b.h"
+#include "../blake2s/blake2s.h"
+#include "../blake2bp/blake2bp.h"
+#include "../blake2sp/blake2sp.h"
+#include "../whirlpool/whirlpool.h"
+#include "../has160/has160.h"
+#include "../nt/nt.h"
+#include "../md_lanes/md_lanes.h"
+#include "../keccak1600/keccak1600.h"
+#include "../blake2_lanes/blake2_lanes.h"
+#include "../cpu/cpu_features.h"
+
+/* Hash algorithm enumeration; the values are ABI (Python and JS bindings) */
+typedef enum {
+    HASH_MD4, HASH_NT, HASH_MD5, HASH_HAS160,
+    HASH_RIPEMD256, HASH_RIPEMD128,
+    HASH_BLAKE2S_128, HASH_BLAKE2S_160, HASH_BLAKE2S_256,
+    HASH_BLAKE2B_512, HASH_RIPEMD320,
+    HASH_BLAKE2B_128, HASH_BLAKE2B_384, HASH_RIPEMD160,
+    HASH_BLAKE2B_160, HASH_BLAKE2B_256,
+    HASH_SHA256, HASH_SHA0, HASH_SHA1, HASH_SHA224,
+    HASH_SHA512, HASH_SHA384,
+    HASH_WHIRLPOOL,
+    HASH_SHA3_224, HASH_SHAKE256, HASH_SHA3_384,
+    HASH_SHAKE128, HASH_KECCAK384, HASH_KECCAK256,
+    HASH_SHA3_256, HASH_SHA3_512, HASH_KECCAK512, HASH_KECCAK224,
+    HASH_MD2,
+    HASH_BLAKE2BP_512, HASH_BLAKE2SP_256,
+    HASH_WHIRLPOOL0, HASH_WHIRLPOOLT,
+    HASH_COUNT
+} HashAlgorithm;
+
+#define HASH_MAX_DIGEST 128
+
+/* Streaming state for every supported algorithm */
+typedef union {
+    MD2_CTX md2;
+    MD4_CTX md4;
+    MD5_CTX md5;
+    SHA0_CTX sha0;
+    SHA1_CTX sha1;
+    SHA224_CTX sha224;
+    SHA256_CTX sha256;
+    SHA512_CTX sha512;
+    SHA3_CTX sha3;
+    SHA3_224_CTX sha3_224;
+    SHA3_384_CTX sha3_384;
+    KECCAK_CTX keccak;
+    SHAKE_CTX shake;
+    RIPEMD128_CTX ripemd128;
+    RIPEMD160_CTX ripemd160;
+    RIPEMD256_CTX ripemd256;
+    RIPEMD320_CTX ripemd320;
+    BLAKE2B_CTX blake2b;
+    BLAKE2S_CTX blake2s;
+    BLAKE2BP_CTX blake2bp;
+    BLAKE2SP_CTX blake2sp;
+    WHIRLPOOL_CTX whirlpool;
+    HAS160_CTX has160;
+    NT_CTX nt;
+} HashState;
+
+/* Descriptor flags */
+#define HASH_F_MIDSTATE 0x01    /* state can be cloned after absorbing a prefix */
+
+typedef void (*hash_oneshot_fn)(const uint8_t *data, size_t len, uint8_t *digest);
+typedef void (*hash_init_fn)(HashState *st);
+typedef void (*hash_update_fn)(HashState *st, const uint8_t *data, size_t len);
+typedef void (*hash_final_fn)(HashState *st, uint8_t *digest);
+
+/*
+ * Search finalizer: final for a throwaway state that only matters if the
+ * digest has at least `difficulty` leading zero bits. It tests the leading
+ * state words right after the last compression and returns 0 without
+ * writing anything when they fail; otherwise it writes the digest and
+ * returns 1.
+ */
+typedef int (*hash_final_zeros_fn)(HashState *st, int difficulty, uint8_t *digest);
+
+/*
+ * Multi-lane kernel for nonce search: finish `lanes` messages that share the
+ * midstate `mid` and differ only in their equally long tails (at most
+ * HASH_LANES_MAX_TAIL bytes). Returns the mask of lanes whose digest has at
+ * least `difficulty` leading zero bits; only those lanes' digests are
+ * written, lane i to digests + i * digest_size.
+ */
+#define HASH_MAX_LANES 16
+#define HASH_LANES_MAX_TAIL 32
+
+typedef uint32_t (*hash_lanes_fn)(const HashState *mid, const uint8_t *const *tails, size_t tail_len,
+                                  int difficulty, uint8_t *digests);
+
+typedef struct {
+    HashAlgorithm id;
+    const char *name;
+    int digest_size;
+    int block_size;
+    size_t state_size;          /* live bytes of HashState, for cheap clones */
+    int flags;
+    hash_oneshot_fn hash;
+    hash_init_fn init;
+    hash_update_fn update;
+    hash_final_fn final;
+    hash_final_zeros_fn final_zeros; /* NULL if the algorithm has none */
+    int lanes;                  /* lanes per call of finish_lanes, 1 if none */
+    hash_lanes_fn finish_lanes; /* NULL until a SIMD kernel is registered */
+    const char *backend;        /* "scalar" or the selected kernel's name */
+} HashDescriptor;
+
+/* Descriptor for algo, NULL if it is out of range */
+const HashDescriptor *hash_descriptor(HashAlgorithm algo);
+
+/*
+ * Restrict the CPU features backends may use (cpu_features_force) and
+ * reselect every algorithm's backend. The new table is published atomically,
+ * but the one before it is reused by the next force, so do not keep
+ * descriptors across two forces while searching. Returns the effective
+ * feature mask.
+ */
+uint32_t hash_registry_force(uint32_t mask);
+
+/*
+ * Number of backend selections so far (the first descriptor lookup and
+ * each hash_registry_force). Anything derived from descriptors, such as
+ * measured costs, is stale once this changes.
+ */
+unsigned hash_registry_generation(void);
+
+/* Algorithm id by name (accepts the SHA256/SHA1 aliases), -1 if unknown */
+int hash_algo_by_name(const char *name);
+
+/* One-shot hash through the registry; returns the digest size, 0 if unknown */
+int hash_compute(HashAlgorithm algo, const uint8_t *data, size_t len, uint8_t *digest);
+
+/* Absorb a constant prefix once so it can be shared by many messages */
+static inline void hash_midstate(const HashDescriptor *d, HashState *mid, const uint8_t *prefix, size_t len) {
+    d->init(mid);
+    d->update(mid, prefix, len);
+}
+
+/*
+ * Multi-digest pass: feed one input to n states (of descs[i]) a slice at a
+ * time, so the input is read from memory once and each slice is still in
+ * L1 when the next algorithm takes it. Same result as n separate updates.
+ */
+void hash_multi_update(const HashDescriptor *const *descs, HashState *states, int n, const uint8_t *data,
+                       size_t len);
+
+/* hash_midstate for n algorithms over the same prefix, in one pass */
+void hash_midstates(const HashDescriptor *const *descs, HashState *mids, int n, const uint8_t *prefix, size_t len);
+
+/* Hash prefix || tail from a midstate, leaving the midstate untouched */
+static inline void hash_finish(const HashDescriptor *d, const HashState *mid, const uint8_t *tail, size_t len,
+                               uint8_t *digest) {
+    HashState st;
+    memcpy(&st, mid, d->state_size);
+    d->update(&st, tail, len);
+    d->final(&st, digest);
+}
+
+/*
+ * hash_finish for nonce search: 0 if the digest is known to fail
+ * `difficulty` leading zero bits (it may not have been written), else 1
+ * with the digest written. Without a search finalizer it is always
+ * written and the caller's own check decides.
+ */
+static inline int hash_finish_zeros(const HashDescriptor *d, const HashState *mid, const uint8_t *tail, size_t len,
+                                    int difficulty, uint8_t *digest) {
+    HashState st;
+    memcpy(&st, mid, d->state_size);
+    d->update(&st, tail, len);
+    if (d->final_zeros) return d->final_zeros(&st, difficulty, digest);
+    d->final(&st, digest);
+    return 1;
+}
+
+#endif /* HASH_REGISTRY_H */
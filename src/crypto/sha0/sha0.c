@@ -17,7 +17,7 @@ static const uint32_t K[4] = {
     0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
 };
 
-static void sha0_transform(SHA0_CTX *ctx, const uint8_t block[64]) {
+void sha0_transform_generic(uint32_t state[5], const uint8_t block[64]) {
     uint32_t W[80];
     uint32_t a, b, c, d, e, temp;
     int t;
@@ -33,11 +33,11 @@ static void sha0_transform(SHA0_CTX *ctx, const uint8_t block[64]) {
         W[t] = W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16];
     }
 
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+    e = state[4];
 
     for (t = 0; t < 20; t++) {
         temp = ROTL32(a, 5) + CH(b, c, d) + e + K[0] + W[t];
@@ -56,13 +56,15 @@ static void sha0_transform(SHA0_CTX *ctx, const uint8_t block[64]) {
         e = d; d = c; c = ROTL32(b, 30); b = a; a = temp;
     }
 
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
 }
 
+sha0_compress_fn sha0_compress = sha0_transform_generic;
+
 void sha0_init(SHA0_CTX *ctx) {
     ctx->state[0] = 0x67452301;
     ctx->state[1] = 0xEFCDAB89;
@@ -84,12 +86,12 @@ void sha0_update(SHA0_CTX *ctx, const uint8_t *data, size_t len) {
             return;
         }
         memcpy(ctx->buffer + index, data, left);
-        sha0_transform(ctx, ctx->buffer);
+        sha0_compress(ctx->state, ctx->buffer);
         i = left;
     }
 
     for (; i + SHA0_BLOCK_SIZE <= len; i += SHA0_BLOCK_SIZE) {
-        sha0_transform(ctx, data + i);
+        sha0_compress(ctx->state, data + i);
     }
 
     if (i < len) {
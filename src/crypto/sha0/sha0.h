@@ -18,4 +18,14 @@ void sha0_update(SHA0_CTX *ctx, const uint8_t *data, size_t len);
 void sha0_final(uint8_t digest[SHA0_DIGEST_LENGTH], SHA0_CTX *ctx);
 void sha0_hash(const uint8_t *data, size_t len, uint8_t digest[SHA0_DIGEST_LENGTH]);
 
+/*
+ * Block compression used by update/final. Points at the portable
+ * sha0_transform_generic unless the registry selects an accelerated kernel.
+ */
+typedef void (*sha0_compress_fn)(uint32_t state[5], const uint8_t block[64]);
+extern sha0_compress_fn sha0_compress;
+void sha0_transform_generic(uint32_t state[5], const uint8_t block[64]);
+/* Intel SHA extensions kernel (x86 only, sha1/sha1_shani.c) */
+void sha0_transform_shani(uint32_t state[5], const uint8_t block[64]);
+
 #endif /* SHA0_H */
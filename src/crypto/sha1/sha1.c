@@ -16,7 +16,7 @@ static const uint32_t K[4] = {
     0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
 };
 
-static void sha1_transform(SHA1_CTX *ctx, const uint8_t block[64]) {
+void sha1_transform_generic(uint32_t state[5], const uint8_t block[64]) {
     uint32_t W[80];
     uint32_t a, b, c, d, e, temp;
     int t;
@@ -32,11 +32,11 @@ static void sha1_transform(SHA1_CTX *ctx, const uint8_t block[64]) {
         W[t] = ROTL32(W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16], 1);
     }
 
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+    e = state[4];
 
     for (t = 0; t < 20; t++) {
         temp = ROTL32(a, 5) + CH(b, c, d) + e + K[0] + W[t];
@@ -55,13 +55,15 @@ static void sha1_transform(SHA1_CTX *ctx, const uint8_t block[64]) {
         e = d; d = c; c = ROTL32(b, 30); b = a; a = temp;
     }
 
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
 }
 
+sha1_compress_fn sha1_compress = sha1_transform_generic;
+
 void sha1_init(SHA1_CTX *ctx) {
     ctx->state[0] = 0x67452301;
     ctx->state[1] = 0xEFCDAB89;
@@ -83,12 +85,12 @@ void sha1_update(SHA1_CTX *ctx, const uint8_t *data, size_t len) {
             return;
         }
         memcpy(ctx->buffer + index, data, left);
-        sha1_transform(ctx, ctx->buffer);
+        sha1_compress(ctx->state, ctx->buffer);
         i = left;
     }
 
     for (; i + SHA1_BLOCK_SIZE <= len; i += SHA1_BLOCK_SIZE) {
-        sha1_transform(ctx, data + i);
+        sha1_compress(ctx->state, data + i);
     }
 
     if (i < len) {
@@ -96,7 +98,7 @@ void sha1_update(SHA1_CTX *ctx, const uint8_t *data, size_t len) {
     }
 }
 
-void sha1_final(uint8_t digest[SHA1_DIGEST_LENGTH], SHA1_CTX *ctx) {
+void sha1_final_state(SHA1_CTX *ctx) {
     uint8_t pad[SHA1_BLOCK_SIZE];
     uint64_t bits = ctx->count * 8;
     size_t index = (size_t)(ctx->count & 0x3F);
@@ -116,6 +118,10 @@ void sha1_final(uint8_t digest[SHA1_DIGEST_LENGTH], SHA1_CTX *ctx) {
     pad[6] = (uint8_t)(bits >> 8);
     pad[7] = (uint8_t)(bits);
     sha1_update(ctx, pad, 8);
+}
+
+void sha1_final(uint8_t digest[SHA1_DIGEST_LENGTH], SHA1_CTX *ctx) {
+    sha1_final_state(ctx);
 
     for (int i = 0; i < 5; i++) {
         digest[i * 4] = (uint8_t)(ctx->state[i] >> 24);
@@ -18,4 +18,18 @@ void sha1_update(SHA1_CTX *ctx, const uint8_t *data, size_t len);
 void sha1_final(uint8_t digest[SHA1_DIGEST_LENGTH], SHA1_CTX *ctx);
 void sha1_hash(const uint8_t *data, size_t len, uint8_t digest[SHA1_DIGEST_LENGTH]);
 
+/* Padding and last compression only; ctx->state is then the digest as
+ * big-endian words */
+void sha1_final_state(SHA1_CTX *ctx);
+
+/*
+ * Block compression used by update/final. Points at the portable
+ * sha1_transform_generic unless the registry selects an accelerated kernel.
+ */
+typedef void (*sha1_compress_fn)(uint32_t state[5], const uint8_t block[64]);
+extern sha1_compress_fn sha1_compress;
+void sha1_transform_generic(uint32_t state[5], const uint8_t block[64]);
+/* Intel SHA extensions kernel (x86 only, sha1/sha1_shani.c) */
+void sha1_transform_shani(uint32_t state[5], const uint8_t block[64]);
+
 #endif /* SHA1_H */
@@ -0,0 +1,84 @@
+/*
+ * SHA-1 and SHA-0 compression with the Intel SHA extensions (SHA-NI)
+ *
+ * sha1rnds4 runs four rounds and sha1nexte derives the next E term from
+ * the previous ABCD. SHA-0 differs from SHA-1 only in its message schedule
+ * (no rotate), so it feeds the same round instructions from a scalar
+ * schedule; SHA-1 builds its schedule with sha1msg1/msg2.
+ * Selected at runtime by the hash registry when cpuid reports SHA.
+ */
+
+#include "sha1.h"
+#include "../sha0/sha0.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+// Four rounds with round function f (0..3) on schedule words w
+#define ROUNDS4(w, f) do { \
+    e = _mm_sha1nexte_epu32(prev, (w)); \
+    prev = abcd; \
+    abcd = _mm_sha1rnds4_epu32(abcd, e, (f)); \
+} while (0)
+
+// 80 rounds over a prepared schedule; words are big-endian lane order
+// (w[i] holds W[4i] in its top lane)
+static inline __attribute__((always_inline, target("sha,sse4.1")))
+void sha1_rounds_shani(uint32_t state[5], const __m128i w[20]) {
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1B);
+    __m128i e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+    __m128i abcd_save = abcd, prev, e;
+    int i;
+
+    e = _mm_add_epi32(e0, w[0]);
+    prev = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+    for (i = 1; i < 5; i++) ROUNDS4(w[i], 0);
+    for (; i < 10; i++) ROUNDS4(w[i], 1);
+    for (; i < 15; i++) ROUNDS4(w[i], 2);
+    for (; i < 20; i++) ROUNDS4(w[i], 3);
+
+    e = _mm_sha1nexte_epu32(prev, e0);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+    _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1B));
+    state[4] = (uint32_t)_mm_extract_epi32(e, 3);
+}
+
+__attribute__((target("sha,sse4.1")))
+void sha1_transform_shani(uint32_t state[5], const uint8_t block[64]) {
+    const __m128i bswap = _mm_set_epi64x(0x0001020304050607LL, 0x08090a0b0c0d0e0fLL);
+    __m128i w[20];
+
+    for (int i = 0; i < 4; i++) {
+        w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(block + 16 * i)), bswap);
+    }
+    // W[t] = rol1(W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]), four words at a time
+    for (int i = 4; i < 20; i++) {
+        w[i] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(w[i - 4], w[i - 3]), w[i - 2]), w[i - 1]);
+    }
+    sha1_rounds_shani(state, w);
+}
+
+__attribute__((target("sha,sse4.1")))
+void sha0_transform_shani(uint32_t state[5], const uint8_t block[64]) {
+    uint32_t W[80];
+    __m128i w[20];
+    int t;
+
+    for (t = 0; t < 16; t++) {
+        W[t] = ((uint32_t)block[t * 4] << 24) |
+               ((uint32_t)block[t * 4 + 1] << 16) |
+               ((uint32_t)block[t * 4 + 2] << 8) |
+               ((uint32_t)block[t * 4 + 3]);
+    }
+    for (t = 16; t < 80; t++) {
+        W[t] = W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16];
+    }
+    for (t = 0; t < 20; t++) {
+        w[t] = _mm_set_epi32((int)W[4 * t], (int)W[4 * t + 1], (int)W[4 * t + 2], (int)W[4 * t + 3]);
+    }
+    sha1_rounds_shani(state, w);
+}
+
+#endif /* CPU_X86_KERNELS */
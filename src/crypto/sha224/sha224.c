@@ -4,48 +4,13 @@
  */
 
 #include "sha224.h"
+#include "../sha256/sha256.h"
 #include <string.h>
 
-#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
-#define CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
-#define EP0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
-#define EP1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
-#define SIG0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
-#define SIG1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
-
-static const uint32_t k[64] = {
-    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-};
-
+// The compression function is SHA-256's, so SHA-224 picks up whichever
+// kernel the registry selected for it
 static void sha224_transform(SHA224_CTX *ctx, const uint8_t data[]) {
-    uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
-
-    for (i = 0, j = 0; i < 16; ++i, j += 4)
-        m[i] = ((uint32_t)data[j] << 24) | ((uint32_t)data[j + 1] << 16) |
-               ((uint32_t)data[j + 2] << 8) | ((uint32_t)data[j + 3]);
-    for (; i < 64; ++i)
-        m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-    a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
-    e = ctx->state[4]; f = ctx->state[5]; g = ctx->state[6]; h = ctx->state[7];
-
-    for (i = 0; i < 64; ++i) {
-        t1 = h + EP1(e) + CH(e, f, g) + k[i] + m[i];
-        t2 = EP0(a) + MAJ(a, b, c);
-        h = g; g = f; f = e; e = d + t1;
-        d = c; c = b; b = a; a = t1 + t2;
-    }
-
-    ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
-    ctx->state[4] += e; ctx->state[5] += f; ctx->state[6] += g; ctx->state[7] += h;
+    sha256_compress(ctx->state, data);
 }
 
 void sha224_init(SHA224_CTX *ctx) {
@@ -73,7 +38,7 @@ void sha224_update(SHA224_CTX *ctx, const uint8_t *data, size_t len) {
     }
 }
 
-void sha224_final(SHA224_CTX *ctx, uint8_t hash[SHA224_DIGEST_LENGTH]) {
+void sha224_final_state(SHA224_CTX *ctx) {
     uint32_t i = ctx->datalen;
 
     if (ctx->datalen < 56) {
@@ -96,9 +61,13 @@ void sha224_final(SHA224_CTX *ctx, uint8_t hash[SHA224_DIGEST_LENGTH]) {
     ctx->data[57] = (uint8_t)(ctx->bitlen >> 48);
     ctx->data[56] = (uint8_t)(ctx->bitlen >> 56);
     sha224_transform(ctx, ctx->data);
+}
+
+void sha224_final(SHA224_CTX *ctx, uint8_t hash[SHA224_DIGEST_LENGTH]) {
+    sha224_final_state(ctx);
 
     /* SHA-224 outputs only first 28 bytes (7 words) */
-    for (i = 0; i < 7; ++i) {
+    for (int i = 0; i < 7; ++i) {
         hash[i * 4] = (ctx->state[i] >> 24) & 0xff;
         hash[i * 4 + 1] = (ctx->state[i] >> 16) & 0xff;
         hash[i * 4 + 2] = (ctx->state[i] >> 8) & 0xff;
@@ -19,4 +19,7 @@ void sha224_update(SHA224_CTX *ctx, const uint8_t *data, size_t len);
 void sha224_final(SHA224_CTX *ctx, uint8_t hash[SHA224_DIGEST_LENGTH]);
 void sha224_hash(const uint8_t *data, size_t len, uint8_t hash[SHA224_DIGEST_LENGTH]);
 
+/* Final padding and compression; the digest is ctx->state[0..6] */
+void sha224_final_state(SHA224_CTX *ctx);
+
 #endif /* SHA224_H */
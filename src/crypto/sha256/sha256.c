@@ -11,13 +11,13 @@
 #define SIG1(x)    (ROR(x,17) ^ ROR(x,19) ^ ((x) >> 10))
 // Round macro for maximum inlining
 #define SHA256_ROUND(a,b,c,d,e,f,g,h,i) do { \
-    t1 = h + EP1(e) + CH(e,f,g) + k[i] + w[i]; \
+    t1 = h + EP1(e) + CH(e,f,g) + sha256_k[i] + w[i]; \
     t2 = EP0(a) + MAJ(a,b,c); \
     d += t1; \
     h = t1 + t2; \
 } while(0)
 // K constants aligned for better cache performance
-static const uint32_t k[64] __attribute__((aligned(64))) = {
+const uint32_t sha256_k[64] __attribute__((aligned(64))) = {
     0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
     0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
     0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
@@ -141,6 +141,7 @@ static inline void sha256_transform_optimized(uint32_t state[8], const uint8_t d
 void sha256_transform_fast(uint32_t state[8], const uint8_t data[64]) {
     sha256_transform_optimized(state, data);
 }
+sha256_compress_fn sha256_compress = sha256_transform_fast;
 void sha256_init_state(uint32_t state[8]) {
     state[0] = 0x6a09e667;
     state[1] = 0xbb67ae85;
@@ -160,13 +161,13 @@ void sha256_update(SHA256_CTX *ctx, const uint8_t data[], size_t len) {
     for (size_t i = 0; i < len; i++) {
         ctx->data[ctx->datalen++] = data[i];
         if (ctx->datalen == 64) {
-            sha256_transform_optimized(ctx->state, ctx->data);
+            sha256_compress(ctx->state, ctx->data);
             ctx->bitlen += 512;
             ctx->datalen = 0;
         }
     }
 }
-void sha256_final(SHA256_CTX *ctx, uint8_t hash[]) {
+void sha256_final_state(SHA256_CTX *ctx) {
     uint32_t i = ctx->datalen;
     // Padding
     if (ctx->datalen < 56) {
@@ -177,7 +178,7 @@ void sha256_final(SHA256_CTX *ctx, uint8_t hash[]) {
         ctx->data[i++] = 0x80;
         while (i < 64)
             ctx->data[i++] = 0x00;
-        sha256_transform_optimized(ctx->state, ctx->data);
+        sha256_compress(ctx->state, ctx->data);
         memset(ctx->data, 0, 56);
     }
     // Append length in bits
@@ -190,7 +191,10 @@ void sha256_final(SHA256_CTX *ctx, uint8_t hash[]) {
     ctx->data[58] = ctx->bitlen >> 40;
     ctx->data[57] = ctx->bitlen >> 48;
     ctx->data[56] = ctx->bitlen >> 56;
-    sha256_transform_optimized(ctx->state, ctx->data);
+    sha256_compress(ctx->state, ctx->data);
+}
+void sha256_final(SHA256_CTX *ctx, uint8_t hash[]) {
+    sha256_final_state(ctx);
     // Output hash - unrolled for speed
     hash[0]  = (ctx->state[0] >> 24) & 0xff;
     hash[1]  = (ctx->state[0] >> 16) & 0xff;
@@ -9,15 +9,36 @@ typedef struct {
     uint64_t bitlen;
     uint32_t state[8];
 } SHA256_CTX;
+// Round constants, shared with the accelerated kernels
+extern const uint32_t sha256_k[64];
 // Standard API
 void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const uint8_t data[], size_t len);
 void sha256_final(SHA256_CTX *ctx, uint8_t hash[]);
 void sha256(const uint8_t data[], size_t len, uint8_t hash[]);
+// sha256_final up to the last compression: ctx->state is the digest
+// (big-endian words), nothing is written out
+void sha256_final_state(SHA256_CTX *ctx);
 // Fast POW-optimized functions
 void sha256_transform_fast(uint32_t state[8], const uint8_t data[64]);
 void sha256_double_hash(const uint8_t data[], size_t len, uint8_t hash[]);
 void sha256_init_state(uint32_t state[8]);
+// Block compression used by update/final (SHA-224 shares it). Points at
+// sha256_transform_fast unless the registry selects an accelerated kernel.
+typedef void (*sha256_compress_fn)(uint32_t state[8], const uint8_t data[64]);
+extern sha256_compress_fn sha256_compress;
+// Intel SHA extensions kernel (x86 only, sha256_shani.c)
+void sha256_transform_shani(uint32_t state[8], const uint8_t data[64]);
+// Multi-lane search kernels (x86 only, sha256_avx2.c / sha256_avx512.c).
+// Finish 8 or 16 messages that continue the absorbed prefix in mid with
+// equally long tails (at most SHA256_LANES_MAX_TAIL bytes). Returns the mask
+// of lanes whose digest has at least `difficulty` leading zero bits; only
+// those lanes' digests are written, to digests + 32 * lane.
+#define SHA256_LANES_MAX_TAIL 32
+uint32_t sha256_finish_x8_avx2(const SHA256_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests);
+uint32_t sha256_finish_x16_avx512(const SHA256_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                  int difficulty, uint8_t *digests);
 // Midstate optimization for POW (when prefix doesn't change)
 void sha256_midstate(SHA256_CTX *ctx, const uint8_t data[], size_t len);
 void sha256_final_from_midstate(SHA256_CTX *ctx, const uint8_t remaining[], size_t len, uint8_t hash[]);
@@ -0,0 +1,85 @@
+/*
+ * 8-lane SHA-256 with AVX2
+ *
+ * Hashes eight messages at once, one per 32-bit lane, for nonce search:
+ * every lane continues the same midstate with its own nonce digits, and
+ * the leading-zero test runs on the vector state before anything is
+ * stored. Selected at runtime by the hash registry.
+ */
+
+#include "sha256_lanes.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define ROR(x, n)  _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define XOR3(a, b, c) _mm256_xor_si256(_mm256_xor_si256((a), (b)), (c))
+#define CH(x, y, z)  _mm256_xor_si256(_mm256_and_si256((x), (y)), _mm256_andnot_si256((x), (z)))
+#define MAJ(x, y, z) _mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+#define EP0(x)  XOR3(ROR(x, 2), ROR(x, 13), ROR(x, 22))
+#define EP1(x)  XOR3(ROR(x, 6), ROR(x, 11), ROR(x, 25))
+#define SIG0(x) XOR3(ROR(x, 7), ROR(x, 18), _mm256_srli_epi32((x), 3))
+#define SIG1(x) XOR3(ROR(x, 17), ROR(x, 19), _mm256_srli_epi32((x), 10))
+
+// One block per lane; w holds the 16 words word-sliced (w[t * 8 + lane])
+static inline __attribute__((always_inline, target("avx2")))
+void sha256_x8_block(__m256i s[8], const uint32_t *w) {
+    __m256i W[16];
+    __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+    for (int t = 0; t < 16; t++) W[t] = _mm256_loadu_si256((const __m256i *)(w + 8 * t));
+
+    for (int t = 0; t < 64; t++) {
+        if (t >= 16) {
+            W[t & 15] = _mm256_add_epi32(_mm256_add_epi32(SIG1(W[(t - 2) & 15]), W[(t - 7) & 15]),
+                                         _mm256_add_epi32(SIG0(W[(t - 15) & 15]), W[t & 15]));
+        }
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, EP1(e)), _mm256_add_epi32(CH(e, f, g), W[t & 15]));
+        t1 = _mm256_add_epi32(t1, _mm256_set1_epi32((int)sha256_k[t]));
+        __m256i t2 = _mm256_add_epi32(EP0(a), MAJ(a, b, c));
+        h = g; g = f; f = e; e = _mm256_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi32(t1, t2);
+    }
+
+    s[0] = _mm256_add_epi32(s[0], a); s[1] = _mm256_add_epi32(s[1], b);
+    s[2] = _mm256_add_epi32(s[2], c); s[3] = _mm256_add_epi32(s[3], d);
+    s[4] = _mm256_add_epi32(s[4], e); s[5] = _mm256_add_epi32(s[5], f);
+    s[6] = _mm256_add_epi32(s[6], g); s[7] = _mm256_add_epi32(s[7], h);
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits: the whole
+// words must be zero and the next word must be below 2^(32 - rest)
+static inline __attribute__((always_inline, target("avx2")))
+uint32_t sha256_x8_zero_mask(const __m256i s[8], int difficulty) {
+    if (difficulty <= 0) return 0xFF;
+    if (difficulty > 256) return 0;
+
+    __m256i acc = _mm256_setzero_si256();
+    int whole = difficulty / 32, rest = difficulty % 32;
+    for (int i = 0; i < whole; i++) acc = _mm256_or_si256(acc, s[i]);
+    if (rest) acc = _mm256_or_si256(acc, _mm256_srl_epi32(s[whole], _mm_cvtsi32_si128(32 - rest)));
+
+    __m256i zero = _mm256_cmpeq_epi32(acc, _mm256_setzero_si256());
+    return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(zero));
+}
+
+__attribute__((target("avx2")))
+uint32_t sha256_finish_x8_avx2(const SHA256_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests) {
+    uint32_t w[32 * 8], h[8 * 8];
+    __m256i s[8];
+
+    int nblocks = sha256_lanes_blocks(mid, tails, tail_len, 8, w);
+    for (int i = 0; i < 8; i++) s[i] = _mm256_set1_epi32((int)mid->state[i]);
+    for (int b = 0; b < nblocks; b++) sha256_x8_block(s, w + b * 16 * 8);
+
+    uint32_t mask = sha256_x8_zero_mask(s, difficulty);
+    if (mask) {
+        for (int i = 0; i < 8; i++) _mm256_storeu_si256((__m256i *)(h + 8 * i), s[i]);
+        sha256_lanes_store(h, 8, mask, digests);
+    }
+    return mask;
+}
+
+#endif /* CPU_X86_KERNELS */
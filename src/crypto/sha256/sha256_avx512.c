@@ -0,0 +1,82 @@
+/*
+ * 16-lane SHA-256 with AVX-512F
+ *
+ * Same scheme as sha256_avx2.c on 512-bit vectors, using the native rotate
+ * and three-input logic instructions for the round functions. Selected at
+ * runtime by the hash registry.
+ */
+
+#include "sha256_lanes.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define ROR(x, n)     _mm512_ror_epi32((x), (n))
+#define XOR3(a, b, c) _mm512_ternarylogic_epi32((a), (b), (c), 0x96)
+#define CH(x, y, z)   _mm512_ternarylogic_epi32((x), (y), (z), 0xCA)
+#define MAJ(x, y, z)  _mm512_ternarylogic_epi32((x), (y), (z), 0xE8)
+#define EP0(x)  XOR3(ROR(x, 2), ROR(x, 13), ROR(x, 22))
+#define EP1(x)  XOR3(ROR(x, 6), ROR(x, 11), ROR(x, 25))
+#define SIG0(x) XOR3(ROR(x, 7), ROR(x, 18), _mm512_srli_epi32((x), 3))
+#define SIG1(x) XOR3(ROR(x, 17), ROR(x, 19), _mm512_srli_epi32((x), 10))
+
+// One block per lane; w holds the 16 words word-sliced (w[t * 16 + lane])
+static inline __attribute__((always_inline, target("avx512f")))
+void sha256_x16_block(__m512i s[8], const uint32_t *w) {
+    __m512i W[16];
+    __m512i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+    for (int t = 0; t < 16; t++) W[t] = _mm512_loadu_si512((const void *)(w + 16 * t));
+
+    for (int t = 0; t < 64; t++) {
+        if (t >= 16) {
+            W[t & 15] = _mm512_add_epi32(_mm512_add_epi32(SIG1(W[(t - 2) & 15]), W[(t - 7) & 15]),
+                                         _mm512_add_epi32(SIG0(W[(t - 15) & 15]), W[t & 15]));
+        }
+        __m512i t1 = _mm512_add_epi32(_mm512_add_epi32(h, EP1(e)), _mm512_add_epi32(CH(e, f, g), W[t & 15]));
+        t1 = _mm512_add_epi32(t1, _mm512_set1_epi32((int)sha256_k[t]));
+        __m512i t2 = _mm512_add_epi32(EP0(a), MAJ(a, b, c));
+        h = g; g = f; f = e; e = _mm512_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm512_add_epi32(t1, t2);
+    }
+
+    s[0] = _mm512_add_epi32(s[0], a); s[1] = _mm512_add_epi32(s[1], b);
+    s[2] = _mm512_add_epi32(s[2], c); s[3] = _mm512_add_epi32(s[3], d);
+    s[4] = _mm512_add_epi32(s[4], e); s[5] = _mm512_add_epi32(s[5], f);
+    s[6] = _mm512_add_epi32(s[6], g); s[7] = _mm512_add_epi32(s[7], h);
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits
+static inline __attribute__((always_inline, target("avx512f")))
+uint32_t sha256_x16_zero_mask(const __m512i s[8], int difficulty) {
+    if (difficulty <= 0) return 0xFFFF;
+    if (difficulty > 256) return 0;
+
+    __m512i acc = _mm512_setzero_si512();
+    int whole = difficulty / 32, rest = difficulty % 32;
+    for (int i = 0; i < whole; i++) acc = _mm512_or_si512(acc, s[i]);
+    if (rest) acc = _mm512_or_si512(acc, _mm512_srl_epi32(s[whole], _mm_cvtsi32_si128(32 - rest)));
+
+    return (uint32_t)_mm512_cmpeq_epi32_mask(acc, _mm512_setzero_si512());
+}
+
+__attribute__((target("avx512f")))
+uint32_t sha256_finish_x16_avx512(const SHA256_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                  int difficulty, uint8_t *digests) {
+    uint32_t w[32 * 16], h[8 * 16];
+    __m512i s[8];
+
+    int nblocks = sha256_lanes_blocks(mid, tails, tail_len, 16, w);
+    for (int i = 0; i < 8; i++) s[i] = _mm512_set1_epi32((int)mid->state[i]);
+    for (int b = 0; b < nblocks; b++) sha256_x16_block(s, w + b * 16 * 16);
+
+    uint32_t mask = sha256_x16_zero_mask(s, difficulty);
+    if (mask) {
+        for (int i = 0; i < 8; i++) _mm512_storeu_si512((void *)(h + 16 * i), s[i]);
+        sha256_lanes_store(h, 16, mask, digests);
+    }
+    return mask;
+}
+
+#endif /* CPU_X86_KERNELS */
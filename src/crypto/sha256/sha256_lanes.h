@@ -0,0 +1,69 @@
+#ifndef SHA256_LANES_H
+#define SHA256_LANES_H
+
+/*
+ * Scalar helpers shared by the multi-lane SHA-256 kernels: laying out the
+ * final blocks word-sliced by lane, and writing digests back out.
+ * Internal to sha256_avx2.c / sha256_avx512.c.
+ */
+
+#include "sha256.h"
+#include <string.h>
+
+// Final blocks (1 or 2) of `lanes` messages continuing mid with equally long
+// tails, as big-endian words sliced by lane: w[t * lanes + lane] is word t
+// (0..31) of the lane. Returns the number of blocks.
+static inline int sha256_lanes_blocks(const SHA256_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                      int lanes, uint32_t *w) {
+    uint8_t block[128];
+    size_t used = mid->datalen + tail_len;
+    int nblocks = used + 9 <= 64 ? 1 : 2;
+    size_t end = (size_t)nblocks * 64;
+    uint64_t bits = mid->bitlen + (uint64_t)used * 8;
+    uint32_t base[32];
+
+    // Everything but the tail is the same in every lane
+    memcpy(block, mid->data, mid->datalen);
+    memset(block + mid->datalen, 0, end - mid->datalen);
+    block[used] = 0x80;
+    for (int i = 0; i < 8; i++) block[end - 1 - i] = (uint8_t)(bits >> (8 * i));
+
+    int words = nblocks * 16;
+    for (int t = 0; t < words; t++) {
+        const uint8_t *p = block + 4 * t;
+        base[t] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    // Words overlapping the tail are rebuilt per lane
+    int first = (int)(mid->datalen / 4);
+    int last = tail_len ? (int)((used - 1) / 4) : first - 1;
+    for (int lane = 0; lane < lanes; lane++) {
+        memcpy(block + mid->datalen, tails[lane], tail_len);
+        for (int t = 0; t < words; t++) {
+            uint32_t v = base[t];
+            if (t >= first && t <= last) {
+                const uint8_t *p = block + 4 * t;
+                v = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+            }
+            w[t * lanes + lane] = v;
+        }
+    }
+    return nblocks;
+}
+
+// Big-endian digests of the lanes in mask; h[t * lanes + lane] is state word t
+static inline void sha256_lanes_store(const uint32_t *h, int lanes, uint32_t mask, uint8_t *digests) {
+    for (int lane = 0; lane < lanes; lane++) {
+        if (!(mask & (1u << lane))) continue;
+        uint8_t *out = digests + 32 * lane;
+        for (int t = 0; t < 8; t++) {
+            uint32_t v = h[t * lanes + lane];
+            out[4 * t] = (uint8_t)(v >> 24);
+            out[4 * t + 1] = (uint8_t)(v >> 16);
+            out[4 * t + 2] = (uint8_t)(v >> 8);
+            out[4 * t + 3] = (uint8_t)v;
+        }
+    }
+}
+
+#endif /* SHA256_LANES_H */
@@ -0,0 +1,69 @@
+/*
+ * SHA-256 compression with the Intel SHA extensions (SHA-NI)
+ *
+ * sha256rnds2 runs two rounds on the state packed as ABEF/CDGH;
+ * sha256msg1/msg2 build the message schedule four words at a time.
+ * Selected at runtime by the hash registry when cpuid reports SHA.
+ */
+
+#include "sha256.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+// Four rounds: two on the low words of W+K, two on the high words
+#define ROUNDS4(w, i) do { \
+    __m128i wk = _mm_add_epi32((w), _mm_loadu_si128((const __m128i *)&sha256_k[4 * (i)])); \
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk); \
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0E)); \
+} while (0)
+
+// Next four schedule words from the previous sixteen (w0 oldest)
+#define SCHEDULE(w0, w1, w2, w3) \
+    _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32((w0), (w1)), _mm_alignr_epi8((w3), (w2), 4)), (w3))
+
+__attribute__((target("sha,sse4.1")))
+void sha256_transform_shani(uint32_t state[8], const uint8_t data[64]) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i abef, cdgh, abef_save, cdgh_save, w0, w1, w2, w3;
+
+    // state[0..3] = ABCD, state[4..7] = EFGH -> ABEF / CDGH
+    __m128i t = _mm_loadu_si128((const __m128i *)&state[0]);
+    cdgh = _mm_loadu_si128((const __m128i *)&state[4]);
+    t = _mm_shuffle_epi32(t, 0xB1);             // CDAB
+    cdgh = _mm_shuffle_epi32(cdgh, 0x1B);       // EFGH
+    abef = _mm_alignr_epi8(t, cdgh, 8);         // ABEF
+    cdgh = _mm_blend_epi16(cdgh, t, 0xF0);      // CDGH
+    abef_save = abef;
+    cdgh_save = cdgh;
+
+    w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), bswap);
+    w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), bswap);
+    w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), bswap);
+    w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), bswap);
+
+    ROUNDS4(w0, 0);
+    ROUNDS4(w1, 1);
+    ROUNDS4(w2, 2);
+    ROUNDS4(w3, 3);
+    for (int i = 4; i < 16; i += 4) {
+        w0 = SCHEDULE(w0, w1, w2, w3); ROUNDS4(w0, i);
+        w1 = SCHEDULE(w1, w2, w3, w0); ROUNDS4(w1, i + 1);
+        w2 = SCHEDULE(w2, w3, w0, w1); ROUNDS4(w2, i + 2);
+        w3 = SCHEDULE(w3, w0, w1, w2); ROUNDS4(w3, i + 3);
+    }
+
+    abef = _mm_add_epi32(abef, abef_save);
+    cdgh = _mm_add_epi32(cdgh, cdgh_save);
+
+    // ABEF / CDGH -> ABCD / EFGH
+    t = _mm_shuffle_epi32(abef, 0x1B);          // FEBA
+    cdgh = _mm_shuffle_epi32(cdgh, 0xB1);       // DCHG
+    abef = _mm_blend_epi16(t, cdgh, 0xF0);      // DCBA
+    cdgh = _mm_alignr_epi8(cdgh, t, 8);         // HGFE
+    _mm_storeu_si128((__m128i *)&state[0], abef);
+    _mm_storeu_si128((__m128i *)&state[4], cdgh);
+}
+
+#endif /* CPU_X86_KERNELS */
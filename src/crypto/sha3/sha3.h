@@ -23,6 +23,7 @@ void keccak_256_init(SHA3_CTX *ctx);
 
 void sha3_update(SHA3_CTX *ctx, const uint8_t *data, size_t len);
 void sha3_final(uint8_t *digest, SHA3_CTX *ctx);
+void keccak_256_final(uint8_t *digest, SHA3_CTX *ctx);  /* 0x01 padding, after keccak_256_init */
 
 void sha3_256_hash(const uint8_t *data, size_t len, uint8_t digest[SHA3_256_DIGEST_LENGTH]);
 void sha3_512_hash(const uint8_t *data, size_t len, uint8_t digest[SHA3_512_DIGEST_LENGTH]);
@@ -8,14 +8,41 @@
 #include <string.h>
 
 #define ROR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
-#define CH(x,y,z)  (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define CH(x,y,z)  ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x,y,z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define SIGMA0(x) (ROR64(x,28) ^ ROR64(x,34) ^ ROR64(x,39))
 #define SIGMA1(x) (ROR64(x,14) ^ ROR64(x,18) ^ ROR64(x,41))
 #define sigma0(x) (ROR64(x, 1) ^ ROR64(x, 8) ^ ((x) >> 7))
 #define sigma1(x) (ROR64(x,19) ^ ROR64(x,61) ^ ((x) >> 6))
 
-static const uint64_t K[80] = {
+/* Big-endian load; compilers turn it into one bswap/movbe */
+#define LOAD64_BE(p) (((uint64_t)(p)[0] << 56) | ((uint64_t)(p)[1] << 48) | ((uint64_t)(p)[2] << 40) | \
+                      ((uint64_t)(p)[3] << 32) | ((uint64_t)(p)[4] << 24) | ((uint64_t)(p)[5] << 16) | \
+                      ((uint64_t)(p)[6] << 8) | (uint64_t)(p)[7])
+
+/* Schedule word t (>= 16) in a 16-word ring */
+#define SCHEDULE(W, t) \
+    (W[(t) & 15] += sigma1(W[((t) - 2) & 15]) + W[((t) - 7) & 15] + sigma0(W[((t) - 15) & 15]))
+
+/* One round with the working variables renamed instead of shifted */
+#define ROUND(a,b,c,d,e,f,g,h,k,w) do {                   \
+    uint64_t t1 = (h) + SIGMA1(e) + CH(e,f,g) + (k) + (w); \
+    (d) += t1;                                             \
+    (h) = t1 + SIGMA0(a) + MAJ(a,b,c);                     \
+} while (0)
+
+#define ROUNDS8(t, WT) do {                                   \
+    ROUND(a,b,c,d,e,f,g,h, sha512_k[(t) + 0], WT((t) + 0));   \
+    ROUND(h,a,b,c,d,e,f,g, sha512_k[(t) + 1], WT((t) + 1));   \
+    ROUND(g,h,a,b,c,d,e,f, sha512_k[(t) + 2], WT((t) + 2));   \
+    ROUND(f,g,h,a,b,c,d,e, sha512_k[(t) + 3], WT((t) + 3));   \
+    ROUND(e,f,g,h,a,b,c,d, sha512_k[(t) + 4], WT((t) + 4));   \
+    ROUND(d,e,f,g,h,a,b,c, sha512_k[(t) + 5], WT((t) + 5));   \
+    ROUND(c,d,e,f,g,h,a,b, sha512_k[(t) + 6], WT((t) + 6));   \
+    ROUND(b,c,d,e,f,g,h,a, sha512_k[(t) + 7], WT((t) + 7));   \
+} while (0)
+
+const uint64_t sha512_k[80] __attribute__((aligned(64))) = {
     0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
     0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
     0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
@@ -39,29 +66,23 @@ static const uint64_t K[80] = {
 };
 
 static void sha512_transform(SHA512_CTX *ctx, const uint8_t data[128]) {
-    uint64_t a, b, c, d, e, f, g, h, W[80], T1, T2;
-    int i;
+    uint64_t a, b, c, d, e, f, g, h, W[16];
     
-    for (i = 0; i < 16; i++) {
-        W[i] = ((uint64_t)data[i*8] << 56) | ((uint64_t)data[i*8+1] << 48) |
-               ((uint64_t)data[i*8+2] << 40) | ((uint64_t)data[i*8+3] << 32) |
-               ((uint64_t)data[i*8+4] << 24) | ((uint64_t)data[i*8+5] << 16) |
-               ((uint64_t)data[i*8+6] << 8) | ((uint64_t)data[i*8+7]);
-    }
-    
-    for (i = 16; i < 80; i++) {
-        W[i] = sigma1(W[i-2]) + W[i-7] + sigma0(W[i-15]) + W[i-16];
-    }
+    for (int i = 0; i < 16; i++) W[i] = LOAD64_BE(data + 8 * i);
     
     a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
     e = ctx->state[4]; f = ctx->state[5]; g = ctx->state[6]; h = ctx->state[7];
     
-    for (i = 0; i < 80; i++) {
-        T1 = h + SIGMA1(e) + CH(e,f,g) + K[i] + W[i];
-        T2 = SIGMA0(a) + MAJ(a,b,c);
-        h = g; g = f; f = e; e = d + T1;
-        d = c; c = b; b = a; a = T1 + T2;
+#define W_LOADED(t) W[t]
+#define W_NEXT(t) SCHEDULE(W, t)
+    ROUNDS8(0, W_LOADED);
+    ROUNDS8(8, W_LOADED);
+    for (int t = 16; t < 80; t += 16) {
+        ROUNDS8(t, W_NEXT);
+        ROUNDS8(t + 8, W_NEXT);
     }
+#undef W_LOADED
+#undef W_NEXT
     
     ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
     ctx->state[4] += e; ctx->state[5] += f; ctx->state[6] += g; ctx->state[7] += h;
@@ -117,7 +138,7 @@ void sha512_update(SHA512_CTX *ctx, const uint8_t *data, size_t len) {
     memcpy(&ctx->buffer[index], &data[i], len - i);
 }
 
-void sha512_final(uint8_t digest[SHA512_DIGEST_LENGTH], SHA512_CTX *ctx) {
+void sha512_final_state(SHA512_CTX *ctx) {
     uint8_t bits[16];
     size_t index, padLen;
     static uint8_t padding[128] = { 0x80 };
@@ -131,6 +152,10 @@ void sha512_final(uint8_t digest[SHA512_DIGEST_LENGTH], SHA512_CTX *ctx) {
     padLen = (index < 112) ? (112 - index) : (240 - index);
     sha512_update(ctx, padding, padLen);
     sha512_update(ctx, bits, 16);
+}
+
+void sha512_final(uint8_t digest[SHA512_DIGEST_LENGTH], SHA512_CTX *ctx) {
+    sha512_final_state(ctx);
     
     for (int i = 0; i < 8; i++) {
         digest[i*8]   = (ctx->state[i] >> 56) & 0xff;
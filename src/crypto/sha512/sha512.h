@@ -13,6 +13,9 @@ typedef struct {
 #define SHA512_DIGEST_LENGTH 64
 #define SHA384_DIGEST_LENGTH 48
 
+/* Round constants, shared with the multi-lane kernels */
+extern const uint64_t sha512_k[80];
+
 void sha512_init(SHA512_CTX *ctx);
 void sha512_update(SHA512_CTX *ctx, const uint8_t *data, size_t len);
 void sha512_final(uint8_t digest[SHA512_DIGEST_LENGTH], SHA512_CTX *ctx);
@@ -22,4 +25,24 @@ void sha384_init(SHA512_CTX *ctx);
 void sha384_final(uint8_t digest[SHA384_DIGEST_LENGTH], SHA512_CTX *ctx);
 void sha384_hash(const uint8_t *data, size_t len, uint8_t digest[SHA384_DIGEST_LENGTH]);
 
+/* Shared SHA-512/384 padding and last compression; the digest is then the
+ * leading big-endian words of ctx->state */
+void sha512_final_state(SHA512_CTX *ctx);
+
+/* Multi-lane search kernels (x86 only, sha512_avx2.c / sha512_avx512.c).
+ * Finish 4 or 8 messages that continue the absorbed prefix in mid with
+ * equally long tails (at most SHA512_LANES_MAX_TAIL bytes). Returns the
+ * mask of lanes whose digest has at least `difficulty` leading zero bits;
+ * only those lanes' digests are written, to digests + 64 * lane (48 * lane
+ * for SHA-384). */
+#define SHA512_LANES_MAX_TAIL 32
+uint32_t sha512_finish_x4_avx2(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests);
+uint32_t sha384_finish_x4_avx2(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests);
+uint32_t sha512_finish_x8_avx512(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                 int difficulty, uint8_t *digests);
+uint32_t sha384_finish_x8_avx512(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                 int difficulty, uint8_t *digests);
+
 #endif /* SHA512_H */
@@ -0,0 +1,98 @@
+/*
+ * 4-lane SHA-512 / SHA-384 with AVX2
+ *
+ * Hashes four messages at once, one per 64-bit lane, for nonce search:
+ * every lane continues the same midstate with its own nonce digits, and
+ * the leading-zero test runs on the vector state before anything is
+ * stored. AVX2 has no 64-bit rotate, so each rotation is two shifts and
+ * an or. Selected at runtime by the hash registry.
+ */
+
+#include "sha512_lanes.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define ROR(x, n)  _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+#define XOR3(a, b, c) _mm256_xor_si256(_mm256_xor_si256((a), (b)), (c))
+#define CH(x, y, z)  _mm256_xor_si256((z), _mm256_and_si256((x), _mm256_xor_si256((y), (z))))
+#define MAJ(x, y, z) _mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+#define EP0(x)  XOR3(ROR(x, 28), ROR(x, 34), ROR(x, 39))
+#define EP1(x)  XOR3(ROR(x, 14), ROR(x, 18), ROR(x, 41))
+#define SIG0(x) XOR3(ROR(x, 1), ROR(x, 8), _mm256_srli_epi64((x), 7))
+#define SIG1(x) XOR3(ROR(x, 19), ROR(x, 61), _mm256_srli_epi64((x), 6))
+
+// One block per lane; w holds the 16 words word-sliced (w[t * 4 + lane])
+static inline __attribute__((always_inline, target("avx2")))
+void sha512_x4_block(__m256i s[8], const uint64_t *w) {
+    __m256i W[16];
+    __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+    for (int t = 0; t < 16; t++) W[t] = _mm256_loadu_si256((const __m256i *)(w + 4 * t));
+
+    for (int t = 0; t < 80; t++) {
+        if (t >= 16) {
+            W[t & 15] = _mm256_add_epi64(_mm256_add_epi64(SIG1(W[(t - 2) & 15]), W[(t - 7) & 15]),
+                                         _mm256_add_epi64(SIG0(W[(t - 15) & 15]), W[t & 15]));
+        }
+        __m256i t1 = _mm256_add_epi64(_mm256_add_epi64(h, EP1(e)), _mm256_add_epi64(CH(e, f, g), W[t & 15]));
+        t1 = _mm256_add_epi64(t1, _mm256_set1_epi64x((long long)sha512_k[t]));
+        __m256i t2 = _mm256_add_epi64(EP0(a), MAJ(a, b, c));
+        h = g; g = f; f = e; e = _mm256_add_epi64(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi64(t1, t2);
+    }
+
+    s[0] = _mm256_add_epi64(s[0], a); s[1] = _mm256_add_epi64(s[1], b);
+    s[2] = _mm256_add_epi64(s[2], c); s[3] = _mm256_add_epi64(s[3], d);
+    s[4] = _mm256_add_epi64(s[4], e); s[5] = _mm256_add_epi64(s[5], f);
+    s[6] = _mm256_add_epi64(s[6], g); s[7] = _mm256_add_epi64(s[7], h);
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits: the whole
+// words must be zero and the next word must be below 2^(64 - rest)
+static inline __attribute__((always_inline, target("avx2")))
+uint32_t sha512_x4_zero_mask(const __m256i s[8], int out_len, int difficulty) {
+    if (difficulty <= 0) return 0xF;
+    if (difficulty > out_len * 8) return 0;
+
+    __m256i acc = _mm256_setzero_si256();
+    int whole = difficulty / 64, rest = difficulty % 64;
+    for (int i = 0; i < whole; i++) acc = _mm256_or_si256(acc, s[i]);
+    if (rest) acc = _mm256_or_si256(acc, _mm256_srl_epi64(s[whole], _mm_cvtsi32_si128(64 - rest)));
+
+    __m256i zero = _mm256_cmpeq_epi64(acc, _mm256_setzero_si256());
+    return (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(zero));
+}
+
+static inline __attribute__((always_inline, target("avx2")))
+uint32_t sha512_finish_x4(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len, int out_len,
+                          int difficulty, uint8_t *digests) {
+    uint64_t w[32 * 4], h[8 * 4];
+    __m256i s[8];
+
+    int nblocks = sha512_lanes_blocks(mid, tails, tail_len, 4, w);
+    for (int i = 0; i < 8; i++) s[i] = _mm256_set1_epi64x((long long)mid->state[i]);
+    for (int b = 0; b < nblocks; b++) sha512_x4_block(s, w + b * 16 * 4);
+
+    uint32_t mask = sha512_x4_zero_mask(s, out_len, difficulty);
+    if (mask) {
+        for (int i = 0; i < 8; i++) _mm256_storeu_si256((__m256i *)(h + 4 * i), s[i]);
+        sha512_lanes_store(h, 4, out_len, mask, digests);
+    }
+    return mask;
+}
+
+__attribute__((target("avx2")))
+uint32_t sha512_finish_x4_avx2(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests) {
+    return sha512_finish_x4(mid, tails, tail_len, SHA512_DIGEST_LENGTH, difficulty, digests);
+}
+
+__attribute__((target("avx2")))
+uint32_t sha384_finish_x4_avx2(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                               int difficulty, uint8_t *digests) {
+    return sha512_finish_x4(mid, tails, tail_len, SHA384_DIGEST_LENGTH, difficulty, digests);
+}
+
+#endif /* CPU_X86_KERNELS */
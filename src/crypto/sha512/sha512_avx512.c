@@ -0,0 +1,94 @@
+/*
+ * 8-lane SHA-512 / SHA-384 with AVX-512F
+ *
+ * Same scheme as sha512_avx2.c on 512-bit vectors, where the native 64-bit
+ * rotate and three-input logic instructions make each round function a
+ * few instructions. Selected at runtime by the hash registry.
+ */
+
+#include "sha512_lanes.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+
+#define ROR(x, n)     _mm512_ror_epi64((x), (n))
+#define XOR3(a, b, c) _mm512_ternarylogic_epi64((a), (b), (c), 0x96)
+#define CH(x, y, z)   _mm512_ternarylogic_epi64((x), (y), (z), 0xCA)
+#define MAJ(x, y, z)  _mm512_ternarylogic_epi64((x), (y), (z), 0xE8)
+#define EP0(x)  XOR3(ROR(x, 28), ROR(x, 34), ROR(x, 39))
+#define EP1(x)  XOR3(ROR(x, 14), ROR(x, 18), ROR(x, 41))
+#define SIG0(x) XOR3(ROR(x, 1), ROR(x, 8), _mm512_srli_epi64((x), 7))
+#define SIG1(x) XOR3(ROR(x, 19), ROR(x, 61), _mm512_srli_epi64((x), 6))
+
+// One block per lane; w holds the 16 words word-sliced (w[t * 8 + lane])
+static inline __attribute__((always_inline, target("avx512f")))
+void sha512_x8_block(__m512i s[8], const uint64_t *w) {
+    __m512i W[16];
+    __m512i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+    for (int t = 0; t < 16; t++) W[t] = _mm512_loadu_si512((const void *)(w + 8 * t));
+
+    for (int t = 0; t < 80; t++) {
+        if (t >= 16) {
+            W[t & 15] = _mm512_add_epi64(_mm512_add_epi64(SIG1(W[(t - 2) & 15]), W[(t - 7) & 15]),
+                                         _mm512_add_epi64(SIG0(W[(t - 15) & 15]), W[t & 15]));
+        }
+        __m512i t1 = _mm512_add_epi64(_mm512_add_epi64(h, EP1(e)), _mm512_add_epi64(CH(e, f, g), W[t & 15]));
+        t1 = _mm512_add_epi64(t1, _mm512_set1_epi64((long long)sha512_k[t]));
+        __m512i t2 = _mm512_add_epi64(EP0(a), MAJ(a, b, c));
+        h = g; g = f; f = e; e = _mm512_add_epi64(d, t1);
+        d = c; c = b; b = a; a = _mm512_add_epi64(t1, t2);
+    }
+
+    s[0] = _mm512_add_epi64(s[0], a); s[1] = _mm512_add_epi64(s[1], b);
+    s[2] = _mm512_add_epi64(s[2], c); s[3] = _mm512_add_epi64(s[3], d);
+    s[4] = _mm512_add_epi64(s[4], e); s[5] = _mm512_add_epi64(s[5], f);
+    s[6] = _mm512_add_epi64(s[6], g); s[7] = _mm512_add_epi64(s[7], h);
+}
+
+// Lanes whose digest starts with at least `difficulty` zero bits
+static inline __attribute__((always_inline, target("avx512f")))
+uint32_t sha512_x8_zero_mask(const __m512i s[8], int out_len, int difficulty) {
+    if (difficulty <= 0) return 0xFF;
+    if (difficulty > out_len * 8) return 0;
+
+    __m512i acc = _mm512_setzero_si512();
+    int whole = difficulty / 64, rest = difficulty % 64;
+    for (int i = 0; i < whole; i++) acc = _mm512_or_si512(acc, s[i]);
+    if (rest) acc = _mm512_or_si512(acc, _mm512_srl_epi64(s[whole], _mm_cvtsi32_si128(64 - rest)));
+
+    return (uint32_t)_mm512_cmpeq_epi64_mask(acc, _mm512_setzero_si512());
+}
+
+static inline __attribute__((always_inline, target("avx512f")))
+uint32_t sha512_finish_x8(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len, int out_len,
+                          int difficulty, uint8_t *digests) {
+    uint64_t w[32 * 8], h[8 * 8];
+    __m512i s[8];
+
+    int nblocks = sha512_lanes_blocks(mid, tails, tail_len, 8, w);
+    for (int i = 0; i < 8; i++) s[i] = _mm512_set1_epi64((long long)mid->state[i]);
+    for (int b = 0; b < nblocks; b++) sha512_x8_block(s, w + b * 16 * 8);
+
+    uint32_t mask = sha512_x8_zero_mask(s, out_len, difficulty);
+    if (mask) {
+        for (int i = 0; i < 8; i++) _mm512_storeu_si512((void *)(h + 8 * i), s[i]);
+        sha512_lanes_store(h, 8, out_len, mask, digests);
+    }
+    return mask;
+}
+
+__attribute__((target("avx512f")))
+uint32_t sha512_finish_x8_avx512(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                 int difficulty, uint8_t *digests) {
+    return sha512_finish_x8(mid, tails, tail_len, SHA512_DIGEST_LENGTH, difficulty, digests);
+}
+
+__attribute__((target("avx512f")))
+uint32_t sha384_finish_x8_avx512(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                 int difficulty, uint8_t *digests) {
+    return sha512_finish_x8(mid, tails, tail_len, SHA384_DIGEST_LENGTH, difficulty, digests);
+}
+
+#endif /* CPU_X86_KERNELS */
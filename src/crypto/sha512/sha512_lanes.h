@@ -0,0 +1,69 @@
+#ifndef SHA512_LANES_H
+#define SHA512_LANES_H
+
+/*
+ * Scalar helpers shared by the multi-lane SHA-512/384 kernels: laying out
+ * the final blocks word-sliced by lane, and writing digests back out.
+ * Internal to sha512_avx2.c / sha512_avx512.c.
+ */
+
+#include "sha512.h"
+#include <string.h>
+
+static inline uint64_t sha512_lanes_load(const uint8_t *p) {
+    return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+           ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) | ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+}
+
+// Final blocks (1 or 2) of `lanes` messages continuing mid with equally long
+// tails, as big-endian words sliced by lane: w[t * lanes + lane] is word t
+// (0..31) of the lane. Returns the number of blocks.
+static inline int sha512_lanes_blocks(const SHA512_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                      int lanes, uint64_t *w) {
+    uint8_t block[256];
+    size_t buffered = (size_t)((mid->count[0] >> 3) & 0x7F);
+    size_t used = buffered + tail_len;
+    int nblocks = used + 17 <= 128 ? 1 : 2;
+    size_t end = (size_t)nblocks * 128;
+    uint64_t lo = mid->count[0] + ((uint64_t)tail_len << 3);
+    uint64_t hi = mid->count[1] + (lo < mid->count[0]) + ((uint64_t)tail_len >> 61);
+    uint64_t base[32];
+
+    // Everything but the tail is the same in every lane
+    memcpy(block, mid->buffer, buffered);
+    memset(block + buffered, 0, end - buffered);
+    block[used] = 0x80;
+    for (int i = 0; i < 8; i++) {
+        block[end - 1 - i] = (uint8_t)(lo >> (8 * i));
+        block[end - 9 - i] = (uint8_t)(hi >> (8 * i));
+    }
+
+    int words = nblocks * 16;
+    for (int t = 0; t < words; t++) base[t] = sha512_lanes_load(block + 8 * t);
+
+    // Words overlapping the tail are rebuilt per lane
+    int first = (int)(buffered / 8);
+    int last = tail_len ? (int)((used - 1) / 8) : first - 1;
+    for (int lane = 0; lane < lanes; lane++) {
+        memcpy(block + buffered, tails[lane], tail_len);
+        for (int t = 0; t < words; t++) {
+            w[t * lanes + lane] = t >= first && t <= last ? sha512_lanes_load(block + 8 * t) : base[t];
+        }
+    }
+    return nblocks;
+}
+
+// Big-endian digests (out_len bytes: 64 for SHA-512, 48 for SHA-384) of the
+// lanes in mask; h[t * lanes + lane] is state word t
+static inline void sha512_lanes_store(const uint64_t *h, int lanes, int out_len, uint32_t mask, uint8_t *digests) {
+    for (int lane = 0; lane < lanes; lane++) {
+        if (!(mask & (1u << lane))) continue;
+        uint8_t *out = digests + out_len * lane;
+        for (int t = 0; t < out_len / 8; t++) {
+            uint64_t v = h[t * lanes + lane];
+            for (int i = 0; i < 8; i++) out[8 * t + i] = (uint8_t)(v >> (56 - 8 * i));
+        }
+    }
+}
+
+#endif /* SHA512_LANES_H */
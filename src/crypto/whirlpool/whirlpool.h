@@ -7,11 +7,22 @@
 #define WHIRLPOOL_DIGEST_LENGTH 64
 #define WHIRLPOOL_BLOCK_SIZE 64
 
+/*
+ * Revisions of the cipher. The original Whirlpool-0 used a random S-box and
+ * the diffusion matrix circ(1,1,3,1,5,8,9,5); Whirlpool-T moved to the
+ * recursive S-box, and the final Whirlpool to circ(1,1,4,1,8,5,2,9). All
+ * three share the padding and the Miyaguchi-Preneel chaining.
+ */
+#define WHIRLPOOL_FINAL 0
+#define WHIRLPOOL_0     1
+#define WHIRLPOOL_T     2
+
 typedef struct {
     uint64_t state[8];
     uint8_t buffer[WHIRLPOOL_BLOCK_SIZE];
     size_t buffer_len;
     uint64_t bit_count[4];
+    int variant;
 } WHIRLPOOL_CTX;
 
 void whirlpool_init(WHIRLPOOL_CTX *ctx);
@@ -19,8 +30,35 @@ void whirlpool_update(WHIRLPOOL_CTX *ctx, const uint8_t *data, size_t len);
 void whirlpool_final(uint8_t digest[WHIRLPOOL_DIGEST_LENGTH], WHIRLPOOL_CTX *ctx);
 void whirlpool_hash(const uint8_t *data, size_t len, uint8_t digest[WHIRLPOOL_DIGEST_LENGTH]);
 
-/* Variants */
+/* Variants; update and final are shared */
+void whirlpool0_init(WHIRLPOOL_CTX *ctx);
+void whirlpoolt_init(WHIRLPOOL_CTX *ctx);
 void whirlpool0_hash(const uint8_t *data, size_t len, uint8_t digest[WHIRLPOOL_DIGEST_LENGTH]);
 void whirlpoolt_hash(const uint8_t *data, size_t len, uint8_t digest[WHIRLPOOL_DIGEST_LENGTH]);
 
+/* Round constants of each variant (indexed by WHIRLPOOL_FINAL/_0/_T),
+ * shared with the accelerated kernel */
+extern const uint64_t whirlpool_rc[3][10];
+
+/*
+ * Compression of nblocks consecutive blocks, used by update/final. Points at
+ * the portable whirlpool_compress_generic unless the registry selects an
+ * accelerated kernel.
+ */
+typedef void (*whirlpool_compress_fn)(uint64_t state[8], const uint8_t *blocks, size_t nblocks,
+                                      int variant);
+extern whirlpool_compress_fn whirlpool_compress;
+void whirlpool_compress_generic(uint64_t state[8], const uint8_t *blocks, size_t nblocks, int variant);
+/* AVX-512 VBMI + GFNI kernel (x86 only, whirlpool/whirlpool_gfni.c) */
+void whirlpool_compress_gfni(uint64_t state[8], const uint8_t *blocks, size_t nblocks, int variant);
+
+/* Search kernel (x86 only, whirlpool_gfni.c). Finishes 4 messages that
+ * continue the absorbed prefix in mid (any variant) with equally long tails
+ * of at most WHIRLPOOL_LANES_MAX_TAIL bytes. Returns the mask of lanes whose
+ * digest has at least `difficulty` leading zero bits; only those lanes'
+ * digests are written, to digests + 64 * lane. */
+#define WHIRLPOOL_LANES_MAX_TAIL 32
+uint32_t whirlpool_finish_x4_gfni(const WHIRLPOOL_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                  int difficulty, uint8_t *digests);
+
 #endif /* WHIRLPOOL_H */
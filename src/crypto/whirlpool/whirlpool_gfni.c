@@ -0,0 +1,240 @@
+/*
+ * Whirlpool with AVX-512 VBMI and GFNI
+ *
+ * The 8x8 byte state fits one 512-bit register, a row per 64-bit lane.
+ * ShiftColumns is one vpermb; the S-box is two 128-entry vpermi2b lookups
+ * picked by the top bit of each byte; MixRows multiplies the substituted
+ * rows by the matrix coefficients with gf2p8affineqb (multiplication by a
+ * constant in GF(2^8) is a linear map on the bits) and rotates each product
+ * into its column. The key schedule runs alongside the state.
+ *
+ * A round is one long dependency chain, so the search kernel interleaves
+ * four messages to keep the units busy. Selected at runtime by the hash
+ * registry.
+ */
+
+#include "whirlpool.h"
+#include "../cpu/cpu_features.h"
+
+#if defined(CPU_X86_KERNELS)
+#include <immintrin.h>
+#include <string.h>
+
+#define WP_TARGET "avx512f,avx512bw,avx512vbmi,gfni"
+
+/* S-boxes: final Whirlpool and Whirlpool-T, then Whirlpool-0 */
+static const uint8_t sbox[2][256] __attribute__((aligned(64))) = {
+    {
+        0x18, 0x23, 0xc6, 0xe8, 0x87, 0xb8, 0x01, 0x4f, 0x36, 0xa6, 0xd2, 0xf5, 0x79, 0x6f, 0x91, 0x52,
+        0x60, 0xbc, 0x9b, 0x8e, 0xa3, 0x0c, 0x7b, 0x35, 0x1d, 0xe0, 0xd7, 0xc2, 0x2e, 0x4b, 0xfe, 0x57,
+        0x15, 0x77, 0x37, 0xe5, 0x9f, 0xf0, 0x4a, 0xda, 0x58, 0xc9, 0x29, 0x0a, 0xb1, 0xa0, 0x6b, 0x85,
+        0xbd, 0x5d, 0x10, 0xf4, 0xcb, 0x3e, 0x05, 0x67, 0xe4, 0x27, 0x41, 0x8b, 0xa7, 0x7d, 0x95, 0xd8,
+        0xfb, 0xee, 0x7c, 0x66, 0xdd, 0x17, 0x47, 0x9e, 0xca, 0x2d, 0xbf, 0x07, 0xad, 0x5a, 0x83, 0x33,
+        0x63, 0x02, 0xaa, 0x71, 0xc8, 0x19, 0x49, 0xd9, 0xf2, 0xe3, 0x5b, 0x88, 0x9a, 0x26, 0x32, 0xb0,
+        0xe9, 0x0f, 0xd5, 0x80, 0xbe, 0xcd, 0x34, 0x48, 0xff, 0x7a, 0x90, 0x5f, 0x20, 0x68, 0x1a, 0xae,
+        0xb4, 0x54, 0x93, 0x22, 0x64, 0xf1, 0x73, 0x12, 0x40, 0x08, 0xc3, 0xec, 0xdb, 0xa1, 0x8d, 0x3d,
+        0x97, 0x00, 0xcf, 0x2b, 0x76, 0x82, 0xd6, 0x1b, 0xb5, 0xaf, 0x6a, 0x50, 0x45, 0xf3, 0x30, 0xef,
+        0x3f, 0x55, 0xa2, 0xea, 0x65, 0xba, 0x2f, 0xc0, 0xde, 0x1c, 0xfd, 0x4d, 0x92, 0x75, 0x06, 0x8a,
+        0xb2, 0xe6, 0x0e, 0x1f, 0x62, 0xd4, 0xa8, 0x96, 0xf9, 0xc5, 0x25, 0x59, 0x84, 0x72, 0x39, 0x4c,
+        0x5e, 0x78, 0x38, 0x8c, 0xd1, 0xa5, 0xe2, 0x61, 0xb3, 0x21, 0x9c, 0x1e, 0x43, 0xc7, 0xfc, 0x04,
+        0x51, 0x99, 0x6d, 0x0d, 0xfa, 0xdf, 0x7e, 0x24, 0x3b, 0xab, 0xce, 0x11, 0x8f, 0x4e, 0xb7, 0xeb,
+        0x3c, 0x81, 0x94, 0xf7, 0xb9, 0x13, 0x2c, 0xd3, 0xe7, 0x6e, 0xc4, 0x03, 0x56, 0x44, 0x7f, 0xa9,
+        0x2a, 0xbb, 0xc1, 0x53, 0xdc, 0x0b, 0x9d, 0x6c, 0x31, 0x74, 0xf6, 0x46, 0xac, 0x89, 0x14, 0xe1,
+        0x16, 0x3a, 0x69, 0x09, 0x70, 0xb6, 0xd0, 0xed, 0xcc, 0x42, 0x98, 0xa4, 0x28, 0x5c, 0xf8, 0x86,
+    },
+    {
+        0x68, 0xd0, 0xeb, 0x2b, 0x48, 0x9d, 0x6a, 0xe4, 0xe3, 0xa3, 0x56, 0x81, 0x7d, 0xf1, 0x85, 0x9e,
+        0x2c, 0x8e, 0x78, 0xca, 0x17, 0xa9, 0x61, 0xd5, 0x5d, 0x0b, 0x8c, 0x3c, 0x77, 0x51, 0x22, 0x42,
+        0x3f, 0x54, 0x41, 0x80, 0xcc, 0x86, 0xb3, 0x18, 0x2e, 0x57, 0x06, 0x62, 0xf4, 0x36, 0xd1, 0x6b,
+        0x1b, 0x65, 0x75, 0x10, 0xda, 0x49, 0x26, 0xf9, 0xcb, 0x66, 0xe7, 0xba, 0xae, 0x50, 0x52, 0xab,
+        0x05, 0xf0, 0x0d, 0x73, 0x3b, 0x04, 0x20, 0xfe, 0xdd, 0xf5, 0xb4, 0x5f, 0x0a, 0xb5, 0xc0, 0xa0,
+        0x71, 0xa5, 0x2d, 0x60, 0x72, 0x93, 0x39, 0x08, 0x83, 0x21, 0x5c, 0x87, 0xb1, 0xe0, 0x00, 0xc3,
+        0x12, 0x91, 0x8a, 0x02, 0x1c, 0xe6, 0x45, 0xc2, 0xc4, 0xfd, 0xbf, 0x44, 0xa1, 0x4c, 0x33, 0xc5,
+        0x84, 0x23, 0x7c, 0xb0, 0x25, 0x15, 0x35, 0x69, 0xff, 0x94, 0x4d, 0x70, 0xa2, 0xaf, 0xcd, 0xd6,
+        0x6c, 0xb7, 0xf8, 0x09, 0xf3, 0x67, 0xa4, 0xea, 0xec, 0xb6, 0xd4, 0xd2, 0x14, 0x1e, 0xe1, 0x24,
+        0x38, 0xc6, 0xdb, 0x4b, 0x7a, 0x3a, 0xde, 0x5e, 0xdf, 0x95, 0xfc, 0xaa, 0xd7, 0xce, 0x07, 0x0f,
+        0x3d, 0x58, 0x9a, 0x98, 0x9c, 0xf2, 0xa7, 0x11, 0x7e, 0x8b, 0x43, 0x03, 0xe2, 0xdc, 0xe5, 0xb2,
+        0x4e, 0xc7, 0x6d, 0xe9, 0x27, 0x40, 0xd8, 0x37, 0x92, 0x8f, 0x01, 0x1d, 0x53, 0x3e, 0x59, 0xc1,
+        0x4f, 0x32, 0x16, 0xfa, 0x74, 0xfb, 0x63, 0x9f, 0x34, 0x1a, 0x2a, 0x5a, 0x8d, 0xc9, 0xcf, 0xf6,
+        0x90, 0x28, 0x88, 0x9b, 0x31, 0x0e, 0xbd, 0x4a, 0xe8, 0x96, 0xa6, 0x0c, 0xc8, 0x79, 0xbc, 0xbe,
+        0xef, 0x6e, 0x46, 0x97, 0x5b, 0xed, 0x19, 0xd9, 0xac, 0x99, 0xa8, 0x29, 0x64, 0x1f, 0xad, 0x55,
+        0x13, 0xbb, 0xf7, 0x6f, 0xb9, 0x47, 0x2f, 0xee, 0xb8, 0x7b, 0x89, 0x30, 0xd3, 0x7f, 0x76, 0x82,
+    },
+};
+
+
+/* vpermb index of ShiftColumns: byte k (from the top) of row s comes from
+ * row s - k. Rows are native 64-bit words, so byte k sits at 8 * s + 7 - k. */
+static const uint8_t shift_columns[64] __attribute__((aligned(64))) = {
+     8, 17, 26, 35, 44, 53, 62,  7, 16, 25, 34, 43, 52, 61,  6, 15,
+    24, 33, 42, 51, 60,  5, 14, 23, 32, 41, 50, 59,  4, 13, 22, 31,
+    40, 49, 58,  3, 12, 21, 30, 39, 48, 57,  2, 11, 20, 29, 38, 47,
+    56,  1, 10, 19, 28, 37, 46, 55,  0,  9, 18, 27, 36, 45, 54, 63,
+};
+
+/* gf2p8affineqb matrices for multiplication by 2..9 modulo x^8+x^4+x^3+x^2+1 */
+#define MUL2 0x8001828488102040ULL
+#define MUL3 0x8103868c983060c0ULL
+#define MUL4 0x408041c2c4881020ULL
+#define MUL5 0x418245cad4a850a0ULL
+#define MUL8 0x2040a061e2c48810ULL
+#define MUL9 0x2142a469f2e4c890ULL
+
+#define MUL(x, m)     _mm512_gf2p8affine_epi64_epi8((x), _mm512_set1_epi64((long long)(m)), 0)
+#define ROR(x, n)     _mm512_ror_epi64((x), (n))
+#define XOR3(a, b, c) _mm512_ternarylogic_epi64((a), (b), (c), 0x96)
+
+typedef struct {
+    __m512i sbox[4];
+    __m512i shift;
+} WpConsts;
+
+static inline __attribute__((always_inline, target(WP_TARGET)))
+void wp_consts(WpConsts *c, int variant) {
+    const uint8_t *s = sbox[variant == WHIRLPOOL_0];
+    for (int i = 0; i < 4; i++) c->sbox[i] = _mm512_load_si512((const void *)(s + 64 * i));
+    c->shift = _mm512_load_si512((const void *)shift_columns);
+}
+
+/*
+ * One round without the key. Output byte j of a row is the sum over t of
+ * coefficient t times substituted byte j - t, i.e. the products rotated
+ * right by t bytes.
+ */
+static inline __attribute__((always_inline, target(WP_TARGET)))
+__m512i wp_round(__m512i x, const WpConsts *c, const int variant) {
+    x = _mm512_permutexvar_epi8(c->shift, x);
+    __m512i lo = _mm512_permutex2var_epi8(c->sbox[0], x, c->sbox[1]);
+    __m512i hi = _mm512_permutex2var_epi8(c->sbox[2], x, c->sbox[3]);
+    x = _mm512_mask_blend_epi8(_mm512_movepi8_mask(x), lo, hi);
+
+    if (variant == WHIRLPOOL_FINAL) {
+        // circ(1, 1, 4, 1, 8, 5, 2, 9)
+        return _mm512_xor_si512(XOR3(x, ROR(x, 8), ROR(x, 24)),
+                                XOR3(XOR3(ROR(MUL(x, MUL4), 16), ROR(MUL(x, MUL8), 32), ROR(MUL(x, MUL5), 40)),
+                                     ROR(MUL(x, MUL2), 48), ROR(MUL(x, MUL9), 56)));
+    }
+    // circ(1, 1, 3, 1, 5, 8, 9, 5)
+    __m512i x5 = MUL(x, MUL5);
+    return _mm512_xor_si512(XOR3(x, ROR(x, 8), ROR(x, 24)),
+                            XOR3(XOR3(ROR(MUL(x, MUL3), 16), ROR(x5, 32), ROR(MUL(x, MUL8), 40)),
+                                 ROR(MUL(x, MUL9), 48), ROR(x5, 56)));
+}
+
+/*
+ * Compress one block per message for n interleaved messages: h[i] is the
+ * chaining value and m[i] the block as native rows.
+ */
+static inline __attribute__((always_inline, target(WP_TARGET)))
+void wp_blocks(__m512i *h, const __m512i *m, int n, const WpConsts *c, const uint64_t *rc, const int variant) {
+    __m512i K[4], S[4];
+
+    for (int i = 0; i < n; i++) {
+        K[i] = h[i];
+        S[i] = _mm512_xor_si512(m[i], h[i]);
+    }
+    for (int r = 0; r < 10; r++) {
+        __m512i k = _mm512_zextsi128_si512(_mm_set_epi64x(0, (long long)rc[r]));
+        for (int i = 0; i < n; i++) {
+            K[i] = _mm512_xor_si512(wp_round(K[i], c, variant), k);
+            S[i] = _mm512_xor_si512(wp_round(S[i], c, variant), K[i]);
+        }
+    }
+    for (int i = 0; i < n; i++) h[i] = XOR3(h[i], S[i], m[i]);
+}
+
+// Blocks are big-endian rows
+static inline __attribute__((always_inline, target(WP_TARGET)))
+__m512i wp_load(const uint8_t *p) {
+    const __m512i bswap = _mm512_set_epi64(0x08090a0b0c0d0e0fLL, 0x0001020304050607LL,
+                                           0x08090a0b0c0d0e0fLL, 0x0001020304050607LL,
+                                           0x08090a0b0c0d0e0fLL, 0x0001020304050607LL,
+                                           0x08090a0b0c0d0e0fLL, 0x0001020304050607LL);
+    return _mm512_shuffle_epi8(_mm512_loadu_si512((const void *)p), bswap);
+}
+
+static inline __attribute__((always_inline, target(WP_TARGET)))
+void wp_compress(uint64_t state[8], const uint8_t *blocks, size_t nblocks, const int variant) {
+    WpConsts c;
+    __m512i h = _mm512_loadu_si512((const void *)state);
+
+    wp_consts(&c, variant);
+    for (; nblocks; nblocks--, blocks += WHIRLPOOL_BLOCK_SIZE) {
+        __m512i m = wp_load(blocks);
+        wp_blocks(&h, &m, 1, &c, whirlpool_rc[variant], variant);
+    }
+    _mm512_storeu_si512((void *)state, h);
+}
+
+__attribute__((target(WP_TARGET)))
+void whirlpool_compress_gfni(uint64_t state[8], const uint8_t *blocks, size_t nblocks, int variant) {
+    switch (variant) {
+    case WHIRLPOOL_0: wp_compress(state, blocks, nblocks, WHIRLPOOL_0); break;
+    case WHIRLPOOL_T: wp_compress(state, blocks, nblocks, WHIRLPOOL_T); break;
+    default:          wp_compress(state, blocks, nblocks, WHIRLPOOL_FINAL); break;
+    }
+}
+
+// Digest has at least `difficulty` leading zero bits (rows are big-endian)
+static int wp_zeros(const uint64_t h[8], int difficulty) {
+    if (difficulty > WHIRLPOOL_DIGEST_LENGTH * 8) return 0;
+    int i = 0;
+    for (; difficulty >= 64; difficulty -= 64)
+        if (h[i++]) return 0;
+    return difficulty <= 0 || (h[i] >> (64 - difficulty)) == 0;
+}
+
+static inline __attribute__((always_inline, target(WP_TARGET)))
+uint32_t wp_finish_x4(const WHIRLPOOL_CTX *mid, const uint8_t *const *tails, size_t tail_len, int difficulty,
+                      uint8_t *digests, const int variant) {
+    uint8_t blocks[4][2 * WHIRLPOOL_BLOCK_SIZE];
+    uint64_t h[4][8];
+    size_t index = (size_t)(mid->bit_count[0] / 8) & 0x3F;
+    uint64_t bits = mid->bit_count[0] + tail_len * 8;
+    // Tail, 0x80 and the 256-bit length fit one block or spill into a second
+    size_t len = index + tail_len + 1 > 32 ? 2 * WHIRLPOOL_BLOCK_SIZE : WHIRLPOOL_BLOCK_SIZE;
+    WpConsts c;
+    __m512i hv[4], m[4];
+    uint32_t mask = 0;
+
+    for (int l = 0; l < 4; l++) {
+        uint8_t *b = blocks[l];
+        memcpy(b, mid->buffer, index);
+        memcpy(b + index, tails[l], tail_len);
+        b[index + tail_len] = 0x80;
+        memset(b + index + tail_len + 1, 0, len - index - tail_len - 1);
+        for (int i = 0; i < 8; i++) {
+            b[len - 1 - i] = (uint8_t)(bits >> (i * 8));
+            b[len - 9 - i] = (uint8_t)(mid->bit_count[1] >> (i * 8));
+        }
+        hv[l] = _mm512_loadu_si512((const void *)mid->state);
+    }
+
+    wp_consts(&c, variant);
+    for (size_t off = 0; off < len; off += WHIRLPOOL_BLOCK_SIZE) {
+        for (int l = 0; l < 4; l++) m[l] = wp_load(blocks[l] + off);
+        wp_blocks(hv, m, 4, &c, whirlpool_rc[variant], variant);
+    }
+
+    for (int l = 0; l < 4; l++) {
+        _mm512_storeu_si512((void *)h[l], hv[l]);
+        if (!wp_zeros(h[l], difficulty)) continue;
+        mask |= 1u << l;
+        for (int i = 0; i < 8; i++)
+            for (int j = 0; j < 8; j++)
+                digests[l * WHIRLPOOL_DIGEST_LENGTH + i * 8 + j] = (uint8_t)(h[l][i] >> (56 - 8 * j));
+    }
+    return mask;
+}
+
+__attribute__((target(WP_TARGET)))
+uint32_t whirlpool_finish_x4_gfni(const WHIRLPOOL_CTX *mid, const uint8_t *const *tails, size_t tail_len,
+                                  int difficulty, uint8_t *digests) {
+    switch (mid->variant) {
+    case WHIRLPOOL_0: return wp_finish_x4(mid, tails, tail_len, difficulty, digests, WHIRLPOOL_0);
+    case WHIRLPOOL_T: return wp_finish_x4(mid, tails, tail_len, difficulty, digests, WHIRLPOOL_T);
+    default:          return wp_finish_x4(mid, tails, tail_len, difficulty, digests, WHIRLPOOL_FINAL);
+    }
+}
+
+#endif /* CPU_X86_KERNELS */
@@ -0,0 +1,65 @@
+#ifndef NONCE_H
+#define NONCE_H
+
+/*
+ * Decimal nonce encoder for the search loops. The digits are kept
+ * right-aligned in a small buffer and incremented in place like an
+ * odometer, so stepping to the next nonce touches only the digits that
+ * change instead of reformatting the whole number with snprintf.
+ * The text is identical to printf("%lld", value).
+ */
+
+#include <stddef.h>
+
+#define NONCE_DIGITS_MAX 24
+
+typedef struct {
+    long long value;
+    int start;                      // first used byte of buf
+    char buf[NONCE_DIGITS_MAX];     // digits occupy buf[start..NONCE_DIGITS_MAX)
+} NonceDigits;
+
+static inline const char *nonce_digits_str(const NonceDigits *nd) {
+    return nd->buf + nd->start;
+}
+
+static inline size_t nonce_digits_len(const NonceDigits *nd) {
+    return (size_t)(NONCE_DIGITS_MAX - nd->start);
+}
+
+static inline void nonce_digits_set(NonceDigits *nd, long long value) {
+    unsigned long long mag = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+    int pos = NONCE_DIGITS_MAX;
+
+    do {
+        nd->buf[--pos] = (char)('0' + mag % 10);
+        mag /= 10;
+    } while (mag);
+    if (value < 0) nd->buf[--pos] = '-';
+
+    nd->value = value;
+    nd->start = pos;
+}
+
+// Step to value + 1. Non-negative values ripple the carry through the
+// trailing '9's and grow by one digit on 99..9 -> 100..0; negative values
+// (rare, only reachable through a negative min_nonce) are re-encoded.
+static inline void nonce_digits_inc(NonceDigits *nd) {
+    if (nd->value < 0) {
+        nonce_digits_set(nd, nd->value + 1);
+        return;
+    }
+    nd->value++;
+
+    int pos = NONCE_DIGITS_MAX - 1;
+    while (pos >= nd->start && nd->buf[pos] == '9') {
+        nd->buf[pos--] = '0';
+    }
+    if (pos >= nd->start) {
+        nd->buf[pos]++;
+    } else {
+        nd->buf[--nd->start] = '1';
+    }
+}
+
+#endif /* NONCE_H */
@@ -1,280 +1,945 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <stdatomic.h>
 #include "export.h"
+#include "threads.h"
+#if defined(_WIN32) || defined(_WIN64)
+    #include <bcrypt.h>
+    #ifdef _MSC_VER
+        #pragma comment(lib, "bcrypt")
+    #endif
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+    #include <errno.h>
+    #include <sys/random.h>
+    #define POW_HAVE_GETRANDOM 1
+#endif
+#include "nonce.h"
+#include "target.h"
 
-// Include all hash headers
-#include "crypto/md2/md2.h"
-#include "crypto/md4/md4.h"
-#include "crypto/md5/md5.h"
-#include "crypto/sha0/sha0.h"
-#include "crypto/sha1/sha1.h"
-#include "crypto/sha224/sha224.h"
-#include "crypto/sha256/sha256.h"
-#include "crypto/sha512/sha512.h"
-#include "crypto/sha3/sha3.h"
-#include "crypto/sha3_224/sha3_224.h"
-#include "crypto/sha3_384/sha3_384.h"
-#include "crypto/keccak/keccak.h"
-#include "crypto/shake/shake.h"
-#include "crypto/ripemd/ripemd160.h"
-#include "crypto/ripemd128/ripemd128.h"
-#include "crypto/ripemd256/ripemd256.h"
-#include "crypto/ripemd320/ripemd320.h"
-#include "crypto/blake2b/blake2b.h"
-#include "crypto/blake2s/blake2s.h"
-#include "crypto/whirlpool/whirlpool.h"
-#include "crypto/has160/has160.h"
-#include "crypto/nt/nt.h"
-
-// Hash algorithm enumeration (must match client)
-typedef enum {
-    HASH_MD4, HASH_NT, HASH_MD5, HASH_HAS160,
-    HASH_RIPEMD256, HASH_RIPEMD128,
-    HASH_BLAKE2S_128, HASH_BLAKE2S_160, HASH_BLAKE2S_256,
-    HASH_BLAKE2B_512, HASH_RIPEMD320,
-    HASH_BLAKE2B_128, HASH_BLAKE2B_384, HASH_RIPEMD160,
-    HASH_BLAKE2B_160, HASH_BLAKE2B_256,
-    HASH_SHA256, HASH_SHA0, HASH_SHA1, HASH_SHA224,
-    HASH_SHA512, HASH_SHA384,
-    HASH_WHIRLPOOL,
-    HASH_SHA3_224, HASH_SHAKE256, HASH_SHA3_384,
-    HASH_SHAKE128, HASH_KECCAK384, HASH_KECCAK256,
-    HASH_SHA3_256, HASH_SHA3_512, HASH_KECCAK512, HASH_KECCAK224,
-    HASH_MD2,
-    HASH_COUNT
-} HashAlgorithm;
-
-// Compute hash based on algorithm
-void compute_hash(HashAlgorithm algo, const uint8_t *data, size_t len, uint8_t *digest, int *digest_size) {
-    memset(digest, 0, 128);
-    
-    switch(algo) {
-        case HASH_MD2: 
-            md2_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_MD4: 
-            md4_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_MD5: 
-            md5_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_SHA0: 
-            sha0_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_SHA1: 
-            sha1_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_SHA224: 
-            sha224_hash(data, len, digest); 
-            *digest_size = 28;
-            break;
-        case HASH_SHA256: 
-            sha256(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_SHA384: 
-            sha384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_SHA512: 
-            sha512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_SHA3_224: 
-            sha3_224_hash(data, len, digest); 
-            *digest_size = 28;
-            break;
-        case HASH_SHA3_256: 
-            sha3_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_SHA3_384: 
-            sha3_384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_SHA3_512: 
-            sha3_512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_KECCAK224: 
-            keccak_224_hash(data, len, digest); 
-            *digest_size = 28;
-            break;
-        case HASH_KECCAK256: 
-            keccak_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_KECCAK384: 
-            keccak_384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_KECCAK512: 
-            keccak_512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_SHAKE128: 
-            shake128_hash(data, len, digest, 32); 
-            *digest_size = 32;
-            break;
-        case HASH_SHAKE256: 
-            shake256_hash(data, len, digest, 64); 
-            *digest_size = 64;
-            break;
-        case HASH_RIPEMD128: 
-            ripemd128_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_RIPEMD160: 
-            ripemd160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_RIPEMD256: 
-            ripemd256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_RIPEMD320: 
-            ripemd320_hash(data, len, digest); 
-            *digest_size = 40;
-            break;
-        case HASH_BLAKE2B_128: 
-            blake2b_128_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_BLAKE2B_160: 
-            blake2b_160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_BLAKE2B_256: 
-            blake2b_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_BLAKE2B_384: 
-            blake2b_384_hash(data, len, digest); 
-            *digest_size = 48;
-            break;
-        case HASH_BLAKE2B_512: 
-            blake2b_512_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_BLAKE2S_128: 
-            blake2s_128_hash(data, len, digest); 
-            *digest_size = 16;
-            break;
-        case HASH_BLAKE2S_160: 
-            blake2s_160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_BLAKE2S_256: 
-            blake2s_256_hash(data, len, digest); 
-            *digest_size = 32;
-            break;
-        case HASH_WHIRLPOOL: 
-            whirlpool_hash(data, len, digest); 
-            *digest_size = 64;
-            break;
-        case HASH_HAS160: 
-            has160_hash(data, len, digest); 
-            *digest_size = 20;
-            break;
-        case HASH_NT: 
-            nt_hash((const char *)data, digest); 
-            *digest_size = 16;
-            break;
-        default: 
-            *digest_size = 0;
-            break;
-    }
+// All hash algorithms, through the shared registry
+#include "crypto/registry/hash_registry.h"
+
+// Algorithms verify_digests absorbs the challenge into together
+#define VERIFY_GROUP 8
+
+// Finish one state with the nonce digits and check its digest
+static int verify_finish(const HashDescriptor *d, HashState *st, const NonceDigits *digits, int difficulty,
+                         const uint8_t *target) {
+    uint8_t hash[HASH_MAX_DIGEST];
+
+    d->update(st, (const uint8_t *)nonce_digits_str(digits), nonce_digits_len(digits));
+    d->final(st, hash);
+    return target ? pow_meets_target(hash, d->digest_size, target)
+                  : pow_has_leading_zeros(hash, d->digest_size, difficulty);
 }
 
-// Check leading zeros
-int has_leading_zeros(uint8_t *hash, int hash_size, int difficulty) {
-    int zeros = 0;
-    for (int i = 0; i < hash_size; i++) {
-        for (int bit = 7; bit >= 0; bit--) {
-            if ((hash[i] >> bit) & 1) return zeros >= difficulty;
-            zeros++;
-            if (zeros >= difficulty) return 1;
+// data || decimal nonce must pass under every algorithm: difficulty leading
+// zero bits, or <= target when one is given
+static int verify_digests(const uint8_t *data, size_t len, int64_t nonce, const HashAlgorithm *algos, int num_algos,
+                          int difficulty, const uint8_t *target) {
+    const HashDescriptor *descs[VERIFY_GROUP];
+    HashState states[VERIFY_GROUP];
+    NonceDigits digits;
+    
+    if (!data && len) return 0;
+    nonce_digits_set(&digits, nonce);
+    if (num_algos < 1) return 1;
+    
+    // The first algorithm alone rejects nearly every wrong nonce, so it runs
+    // before the others read the challenge at all
+    descs[0] = hash_descriptor(algos[0]);
+    if (!descs[0]) return 0;
+    hash_midstate(descs[0], &states[0], data, len);
+    if (!verify_finish(descs[0], &states[0], &digits, difficulty, target)) return 0;
+    
+    // The rest take the challenge together, a group at a time, in one pass
+    for (int i = 1; i < num_algos; i += VERIFY_GROUP) {
+        int n = num_algos - i < VERIFY_GROUP ? num_algos - i : VERIFY_GROUP;
+        for (int k = 0; k < n; k++) {
+            descs[k] = hash_descriptor(algos[i + k]);
+            if (!descs[k]) return 0;
+        }
+        hash_midstates(descs, states, n, data, len);
+        for (int k = 0; k < n; k++) {
+            if (!verify_finish(descs[k], &states[k], &digits, difficulty, target)) {
+                return 0; // One failed, all must pass
+            }
         }
     }
-    return zeros >= difficulty;
+    
+    return 1; // All passed
+}
+
+// Verify PoW over a length-delimited challenge: data || decimal nonce must
+// meet difficulty under every algorithm. The challenge is hashed in place and
+// only the nonce digits are copied, so it may be any length and contain NULs.
+EXPORT int verify_pow_multi_buf(const uint8_t *data, size_t len, int64_t nonce, const HashAlgorithm *algos, int num_algos, int difficulty) {
+    return verify_digests(data, len, nonce, algos, num_algos, difficulty, NULL);
+}
+
+// Target-based verification: every digest, read as a big-endian number,
+// must be <= target (32 bytes, see pow_work_target)
+EXPORT int verify_pow_target(const uint8_t *data, size_t len, int64_t nonce, const HashAlgorithm *algos, int num_algos, const uint8_t *target) {
+    return target ? verify_digests(data, len, nonce, algos, num_algos, 0, target) : 0;
+}
+
+// Target for an expected number of attempts per algorithm (>= 1, need not
+// be a power of two): writes 32 bytes, returns 0 if work is invalid
+EXPORT int pow_work_target(double work, uint8_t *target) {
+    return target ? pow_target_from_work(work, target) : 0;
+}
+
+// verify_pow_multi_buf for a single hash algorithm
+EXPORT int verify_pow_single_buf(const uint8_t *data, size_t len, int64_t nonce, HashAlgorithm algo, int difficulty) {
+    return verify_pow_multi_buf(data, len, nonce, &algo, 1, difficulty);
+}
+
+// Verify PoW for a single hash algorithm (64-bit nonce)
+EXPORT int verify_pow_single64(const char *input, int64_t nonce, HashAlgorithm algo, int difficulty) {
+    return verify_pow_single_buf((const uint8_t *)input, strlen(input), nonce, algo, difficulty);
+}
+
+// Verify PoW for multiple hash algorithms (64-bit nonce, all must pass)
+EXPORT int verify_pow_multi64(const char *input, int64_t nonce, HashAlgorithm *algos, int num_algos, int difficulty) {
+    return verify_pow_multi_buf((const uint8_t *)input, strlen(input), nonce, algos, num_algos, difficulty);
 }
 
 // Verify PoW for a single hash algorithm
 EXPORT int verify_pow_single(const char *input, int nonce, HashAlgorithm algo, int difficulty) {
-    char combined[4096];
-    uint8_t hash[128];
-    int hash_size;
-    size_t len = strlen(input);
-    memcpy(combined, input, len);
-    int n = snprintf(combined + len, sizeof(combined) - len, "%d", nonce);
-    
-    compute_hash(algo, (uint8_t*)combined, len + n, hash, &hash_size);
-    return has_leading_zeros(hash, hash_size, difficulty);
+    return verify_pow_single64(input, nonce, algo, difficulty);
 }
 
 // Verify PoW for multiple hash algorithms (all must pass)
 EXPORT int verify_pow_multi(const char *input, int nonce, HashAlgorithm *algos, int num_algos, int difficulty) {
-    char combined[4096];
-    size_t len = strlen(input);
-    memcpy(combined, input, len);
-    int n = snprintf(combined + len, sizeof(combined) - len, "%d", nonce);
-    
-    if (num_algos > 10) num_algos = 10;
-    
+    return verify_pow_multi64(input, nonce, algos, num_algos, difficulty);
+}
+
+// One submission for verify_pow_batch: input || decimal nonce must meet
+// difficulty under every algorithm, as in verify_pow_multi64
+typedef struct {
+    const char *input;              // challenge, input_len bytes (no NUL needed)
+    size_t input_len;
+    int64_t nonce;
+    const HashAlgorithm *algos;
+    int num_algos;
+    int difficulty;
+} PowSubmission;
+
+// Fanning out is not worth a thread start below this many submissions each
+#define BATCH_MIN_PER_THREAD 256
+
+typedef struct {
+    const PowSubmission *sub;
+    size_t index;                   // position in the caller's array
+    int num_algos;                  // negative counts as 0
+    int tail_len;                   // digits of the nonce
+    char tail[NONCE_DIGITS_MAX];
+} BatchEntry;
+
+typedef struct {
+    BatchEntry *entries;            // a run of the sorted batch
+    size_t count;
+    uint8_t *results;
+} BatchSlice;
+
+// Submissions with the same challenge and algorithms share their midstates
+static int batch_same_group(const BatchEntry *a, const BatchEntry *b) {
+    if (a->sub->input_len != b->sub->input_len || a->num_algos != b->num_algos) return 0;
+    if (a->sub->input != b->sub->input && memcmp(a->sub->input, b->sub->input, a->sub->input_len) != 0) return 0;
+    for (int i = 0; i < a->num_algos; i++) {
+        if (a->sub->algos[i] != b->sub->algos[i]) return 0;
+    }
+    return 1;
+}
+
+// Group order, then nonce length so a group's lane calls fill up
+static int batch_compare(const void *pa, const void *pb) {
+    const BatchEntry *a = (const BatchEntry *)pa, *b = (const BatchEntry *)pb;
+
+    if (a->sub->input_len != b->sub->input_len) return a->sub->input_len < b->sub->input_len ? -1 : 1;
+    if (a->sub->input != b->sub->input) {
+        int c = memcmp(a->sub->input, b->sub->input, a->sub->input_len);
+        if (c) return c;
+    }
+    if (a->num_algos != b->num_algos) return a->num_algos < b->num_algos ? -1 : 1;
+    for (int i = 0; i < a->num_algos; i++) {
+        if (a->sub->algos[i] != b->sub->algos[i]) return a->sub->algos[i] < b->sub->algos[i] ? -1 : 1;
+    }
+    if (a->tail_len != b->tail_len) return a->tail_len < b->tail_len ? -1 : 1;
+    return a->index < b->index ? -1 : a->index > b->index;
+}
+
+// Check every algorithm of one group in turn, hashing only the submissions
+// that passed the previous ones. Consecutive submissions with equally long
+// nonces go through the algorithm's multi-lane kernel when it has one.
+static void batch_verify_group(BatchEntry *e, size_t n, uint8_t *results) {
+    const PowSubmission *first = e[0].sub;
+    uint8_t digests[HASH_MAX_LANES * HASH_MAX_DIGEST];
+    const uint8_t *tails[HASH_MAX_LANES];
+    HashState mid;
+
+    for (size_t k = 0; k < n; k++) results[e[k].index] = 1;
+
+    for (int i = 0; i < e[0].num_algos; i++) {
+        const HashDescriptor *d = hash_descriptor(first->algos[i]);
+        if (!d) {
+            for (size_t k = 0; k < n; k++) results[e[k].index] = 0;
+            return;
+        }
+        hash_midstate(d, &mid, (const uint8_t *)first->input, first->input_len);
+
+        for (size_t k = 0; k < n; ) {
+            if (!results[e[k].index]) {
+                k++;
+                continue;
+            }
+            if (!d->finish_lanes) {
+                int difficulty = e[k].sub->difficulty;
+                results[e[k].index] =
+                    hash_finish_zeros(d, &mid, (const uint8_t *)e[k].tail, e[k].tail_len, difficulty, digests) &&
+                    pow_has_leading_zeros(digests, d->digest_size, difficulty);
+                k++;
+                continue;
+            }
+
+            // Fill the lanes with the next live submissions of this nonce
+            // length; short groups repeat lane 0
+            size_t lane_entry[HASH_MAX_LANES];
+            int tail_len = e[k].tail_len, lanes = 0, min_difficulty = INT_MAX;
+            for (; k < n && lanes < d->lanes && e[k].tail_len == tail_len; k++) {
+                if (!results[e[k].index]) continue;
+                lane_entry[lanes] = k;
+                tails[lanes] = (const uint8_t *)e[k].tail;
+                if (e[k].sub->difficulty < min_difficulty) min_difficulty = e[k].sub->difficulty;
+                lanes++;
+            }
+            for (int l = lanes; l < d->lanes; l++) tails[l] = tails[0];
+
+            // Lanes short of the easiest difficulty fail their own as well;
+            // the others are held to theirs
+            uint32_t mask = d->finish_lanes(&mid, tails, (size_t)tail_len, min_difficulty, digests);
+            for (int l = 0; l < lanes; l++) {
+                const BatchEntry *s = &e[lane_entry[l]];
+                results[s->index] = ((mask >> l) & 1) &&
+                                    pow_has_leading_zeros(digests + l * d->digest_size, d->digest_size, s->sub->difficulty);
+            }
+        }
+    }
+}
+
+static void batch_worker(void *arg) {
+    BatchSlice *slice = (BatchSlice *)arg;
+    BatchEntry *e = slice->entries;
+
+    for (size_t g = 0, end; g < slice->count; g = end) {
+        for (end = g + 1; end < slice->count && batch_same_group(&e[g], &e[end]); end++) {
+        }
+        batch_verify_group(e + g, end - g, slice->results);
+    }
+}
+
+static void batch_entry_init(BatchEntry *e, const PowSubmission *sub, size_t index) {
+    NonceDigits digits;
+
+    nonce_digits_set(&digits, sub->nonce);
+    e->sub = sub;
+    e->index = index;
+    e->num_algos = sub->num_algos < 0 ? 0 : sub->num_algos;
+    e->tail_len = (int)nonce_digits_len(&digits);
+    memcpy(e->tail, nonce_digits_str(&digits), nonce_digits_len(&digits));
+}
+
+// Verify n submissions in one call: results[i] is 1 if subs[i] is valid,
+// else 0. Submissions are sorted so those sharing a challenge and algorithms
+// share their midstates, verified through the multi-lane kernels, and split
+// across `threads` workers (<= 0: one per CPU). Returns the number of valid
+// submissions.
+EXPORT size_t verify_pow_batch(const PowSubmission *subs, size_t n, uint8_t *results, int threads) {
+    BatchEntry *entries = n ? (BatchEntry *)malloc(n * sizeof(BatchEntry)) : NULL;
+    size_t passed = 0;
+
+    if (!entries) {
+        // No room to sort: every submission is its own group
+        for (size_t i = 0; i < n; i++) {
+            BatchEntry one;
+            batch_entry_init(&one, &subs[i], i);
+            batch_verify_group(&one, 1, results);
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) batch_entry_init(&entries[i], &subs[i], i);
+        qsort(entries, n, sizeof(BatchEntry), batch_compare);
+
+        size_t most = n / BATCH_MIN_PER_THREAD;
+        threads = pow_resolve_threads(threads);
+        if ((size_t)threads > most) threads = most ? (int)most : 1;
+
+        BatchSlice slices[POW_MAX_THREADS];
+        for (int t = 0; t < threads; t++) {
+            size_t lo = n * t / threads, hi = n * (t + 1) / threads;
+            slices[t].entries = entries + lo;
+            slices[t].count = hi - lo;
+            slices[t].results = results;
+        }
+        pow_run_parallel(batch_worker, slices, sizeof(slices[0]), threads);
+        free(entries);
+    }
+
+    for (size_t i = 0; i < n; i++) passed += results[i];
+    return passed;
+}
+
+/*
+ * Replay protection
+ *
+ * A PowReplayStore remembers accepted (challenge, nonce) pairs for ttl
+ * seconds so that each solution is accepted at most once. Pairs are keyed
+ * by a 64-bit BLAKE2b digest and stored as pending bit | 39-bit fingerprint |
+ * 24-bit time stamp words in buckets of 8 slots (one cache line); a key may
+ * live in either of two buckets. Slots are claimed with compare-and-swap, so
+ * any number of threads can consume concurrently without a lock, and expired
+ * slots are reused in place. Keys are not secret: every entry costs a valid
+ * PoW solution, which makes aiming them at one bucket impractical.
+ */
+
+#define POW_VERIFY_OK           1   // valid and not seen before (now consumed)
+#define POW_VERIFY_INVALID      0   // PoW does not meet the difficulty
+#define POW_VERIFY_REPLAY      -1   // already accepted within the ttl
+#define POW_VERIFY_STORE_FULL  -2   // both buckets hold live entries: rejected
+#define POW_VERIFY_ERROR       -3
+#define POW_VERIFY_BAD_CHALLENGE -4 // malformed, or not issued with this key
+#define POW_VERIFY_EXPIRED     -5
+
+#define REPLAY_BUCKET_SLOTS 8
+#define REPLAY_STAMP_BITS   24
+#define REPLAY_STAMP_MASK   ((1u << REPLAY_STAMP_BITS) - 1)
+#define REPLAY_PENDING      (1ull << 63)    // claimed, not yet decided (replay_decide)
+
+typedef struct PowReplayStore {
+    _Atomic uint64_t *slots;        // buckets * REPLAY_BUCKET_SLOTS, 64-byte aligned
+    void *raw;                      // allocation behind slots
+    uint32_t bucket_mask;           // buckets - 1 (a power of two)
+    int64_t tick;                   // seconds per time stamp unit
+    uint32_t ttl_ticks;             // entries live this many ticks
+} PowReplayStore;
+
+static int64_t replay_now(int64_t now) {
+    return now > 0 ? now : (int64_t)time(NULL);
+}
+
+static uint32_t replay_stamp(const PowReplayStore *s, int64_t now) {
+    return (uint32_t)(replay_now(now) / s->tick) & REPLAY_STAMP_MASK;
+}
+
+// Ticks since a slot was stamped. Stamps wrap every 2^24 ticks, so the age
+// is taken modulo 2^24 rather than by comparing stamps; an entry left
+// untouched for a whole wrap can look live again, which at worst holds its
+// slot for another ttl.
+static uint32_t replay_age(uint64_t slot, uint32_t stamp) {
+    return (uint32_t)(stamp - (uint32_t)slot) & REPLAY_STAMP_MASK;
+}
+
+static int replay_live(const PowReplayStore *s, uint64_t slot, uint32_t stamp) {
+    return slot && replay_age(slot, stamp) < s->ttl_ticks;
+}
+
+static uint64_t replay_fp(uint64_t slot) {
+    return (slot & ~REPLAY_PENDING) >> REPLAY_STAMP_BITS;
+}
+
+// Create a store for about `capacity` live entries expiring after ttl
+// seconds. Buckets fill unevenly, so allow for twice the expected number of
+// solutions per ttl. NULL on invalid arguments or out of memory.
+EXPORT PowReplayStore *pow_replay_create(size_t capacity, int64_t ttl) {
+    size_t buckets = 2;
+
+    if (ttl <= 0 || capacity > ((size_t)1 << 31)) return NULL;
+    while (buckets * REPLAY_BUCKET_SLOTS < capacity) buckets *= 2;
+
+    PowReplayStore *s = (PowReplayStore *)calloc(1, sizeof(PowReplayStore));
+    if (!s) return NULL;
+    s->raw = calloc(buckets * REPLAY_BUCKET_SLOTS + 8, sizeof(uint64_t));
+    if (!s->raw) {
+        free(s);
+        return NULL;
+    }
+    s->slots = (_Atomic uint64_t *)(((uintptr_t)s->raw + 63) & ~(uintptr_t)63);
+    for (size_t i = 0; i < buckets * REPLAY_BUCKET_SLOTS; i++) atomic_init(&s->slots[i], 0);
+    s->bucket_mask = (uint32_t)(buckets - 1);
+    // Keep the ttl well inside the stamp range so that age comparisons
+    // modulo 2^24 stay unambiguous
+    s->tick = ttl / (1 << (REPLAY_STAMP_BITS - 1)) + 1;
+    s->ttl_ticks = (uint32_t)(ttl / s->tick + (ttl % s->tick != 0));
+    return s;
+}
+
+EXPORT void pow_replay_free(PowReplayStore *store) {
+    if (!store) return;
+    free(store->raw);
+    free(store);
+}
+
+static uint64_t replay_key(const uint8_t *data, size_t len, int64_t nonce) {
+    uint8_t prefix[8], digest[8];
+    NonceDigits digits;
+    BLAKE2B_CTX ctx;
+
+    // The length prefix keeps ("ab", 1) and ("a", "b1") apart
+    for (int i = 0; i < 8; i++) prefix[i] = (uint8_t)((uint64_t)len >> (8 * i));
+    nonce_digits_set(&digits, nonce);
+    blake2b_init(&ctx, sizeof(digest));
+    blake2b_update(&ctx, prefix, sizeof(prefix));
+    blake2b_update(&ctx, data, len);
+    blake2b_update(&ctx, nonce_digits_str(&digits), nonce_digits_len(&digits));
+    blake2b_final(&ctx, digest, sizeof(digest));
+
+    uint64_t key = 0;
+    for (int i = 0; i < 8; i++) key |= (uint64_t)digest[i] << (8 * i);
+    return key;
+}
+
+// Settle a race between inserts of the same key. Each racer claims a slot
+// as pending and then looks for the others' entries; all of this is
+// sequentially consistent, so of any two racers at least one sees the
+// other. Seeing a decided entry, or a pending one in an earlier slot, means
+// backing out. A pending entry in a later slot is waited on until it is
+// decided: the racer holding it never waits (everyone else's slot is earlier
+// from its side), so the wait is short and cannot go in a circle, and the
+// racer in the earliest slot wins unless another one has already won.
+static int replay_decide(const PowReplayStore *s, _Atomic uint64_t *const bucket[2], _Atomic uint64_t *mine,
+                         uint64_t word, uint32_t stamp) {
+    uint64_t fp = replay_fp(word);
+
+    for (int c = 0; c < 2; c++) {
+        for (int j = 0; j < REPLAY_BUCKET_SLOTS; j++) {
+            _Atomic uint64_t *other = &bucket[c][j];
+            if (other == mine) continue;
+            uint64_t v = atomic_load(other);
+            while ((v & REPLAY_PENDING) && other > mine && replay_fp(v) == fp && replay_live(s, v, stamp)) {
+                pow_thread_yield();
+                v = atomic_load(other);
+            }
+            if (replay_fp(v) == fp && replay_live(s, v, stamp)) {
+                // Only clear our own claim: once expired, the slot may be someone else's
+                uint64_t claimed = word | REPLAY_PENDING;
+                atomic_compare_exchange_strong(mine, &claimed, 0);
+                return POW_VERIFY_REPLAY;
+            }
+        }
+    }
+    uint64_t claimed = word | REPLAY_PENDING;
+    atomic_compare_exchange_strong(mine, &claimed, word);
+    return POW_VERIFY_OK;
+}
+
+// Record a key unless it is live already; returns a POW_VERIFY_* code
+static int replay_insert(PowReplayStore *s, uint64_t key, int64_t now) {
+    uint64_t fp = key >> (REPLAY_STAMP_BITS + 1);
+    if (!fp) fp = 1;                // 0 marks an empty slot
+    uint32_t stamp = replay_stamp(s, now);
+    uint64_t word = (fp << REPLAY_STAMP_BITS) | stamp;
+
+    // Two buckets from independent key bits; the xor with an odd value
+    // keeps them distinct
+    uint32_t b1 = (uint32_t)key & s->bucket_mask;
+    uint32_t b2 = (b1 ^ ((uint32_t)((fp * 0x9E3779B97F4A7C15ull) >> 40) | 1)) & s->bucket_mask;
+    _Atomic uint64_t *bucket[2] = {
+        s->slots + (size_t)b1 * REPLAY_BUCKET_SLOTS,
+        s->slots + (size_t)b2 * REPLAY_BUCKET_SLOTS
+    };
+
+    // A live entry, pending or not, means the key is accepted (or about to be)
+    for (int b = 0; b < 2; b++) {
+        for (int i = 0; i < REPLAY_BUCKET_SLOTS; i++) {
+            uint64_t v = atomic_load(&bucket[b][i]);
+            if (replay_fp(v) == fp && replay_live(s, v, stamp)) return POW_VERIFY_REPLAY;
+        }
+    }
+
+    // Another thread may be inserting the same key since the scan above;
+    // replay_decide accepts exactly one of them
+    for (int b = 0; b < 2; b++) {
+        for (int i = 0; i < REPLAY_BUCKET_SLOTS; i++) {
+            _Atomic uint64_t *slot = &bucket[b][i];
+            uint64_t v = atomic_load(slot);
+            if (replay_live(s, v, stamp) || !atomic_compare_exchange_strong(slot, &v, word | REPLAY_PENDING)) continue;
+            return replay_decide(s, bucket, slot, word, stamp);
+        }
+    }
+    return POW_VERIFY_STORE_FULL;
+}
+
+// Mark (data, nonce) as used without verifying it. now <= 0 means the
+// current time (seconds). Returns POW_VERIFY_OK, _REPLAY or _STORE_FULL.
+EXPORT int pow_replay_consume(PowReplayStore *store, const uint8_t *data, size_t len, int64_t nonce, int64_t now) {
+    if (!store || (!data && len)) return POW_VERIFY_ERROR;
+    return replay_insert(store, replay_key(data, len, nonce), now);
+}
+
+// verify_pow_multi_buf, then consume the solution if it is valid. Returns
+// one of the POW_VERIFY_* codes; only POW_VERIFY_OK means accept.
+EXPORT int verify_and_consume(PowReplayStore *store, const uint8_t *data, size_t len, int64_t nonce, const HashAlgorithm *algos, int num_algos, int difficulty, int64_t now) {
+    if (!store || (!data && len)) return POW_VERIFY_ERROR;
+    if (!verify_pow_multi_buf(data, len, nonce, algos, num_algos, difficulty)) return POW_VERIFY_INVALID;
+    return replay_insert(store, replay_key(data, len, nonce), now);
+}
+
+// Number of live entries at time now (<= 0: current time); scans the store
+EXPORT size_t pow_replay_count(const PowReplayStore *store, int64_t now) {
+    size_t live = 0;
+
+    if (!store) return 0;
+    uint32_t stamp = replay_stamp(store, now);
+    size_t slots = ((size_t)store->bucket_mask + 1) * REPLAY_BUCKET_SLOTS;
+    for (size_t i = 0; i < slots; i++) {
+        live += replay_live(store, atomic_load(&store->slots[i]), stamp);
+    }
+    return live;
+}
+
+/*
+ * Stateless challenges
+ *
+ * pow_challenge_issue() packs the algorithms, difficulty, expiry time and a
+ * salt into a token authenticated with a keyed BLAKE2b-128 MAC:
+ *
+ *   version(1) difficulty(1) num_algos(1) algos(num_algos)
+ *   expires(8, LE seconds) salt(16) mac(16)
+ *
+ * encoded as unpadded base64url. The client hashes the token text followed
+ * by the nonce digits, and any server holding the key can check MAC, expiry
+ * and PoW in one call without remembering what it issued.
+ */
+
+#define POW_CHALLENGE_VERSION 1
+#define POW_CHALLENGE_SALT    16
+#define POW_CHALLENGE_MAC     16
+#define POW_CHALLENGE_RAW_MAX (3 + 10 + 8 + POW_CHALLENGE_SALT + POW_CHALLENGE_MAC)
+#define POW_CHALLENGE_MAX     ((POW_CHALLENGE_RAW_MAX * 4 + 2) / 3 + 1)   // text, with the NUL
+
+static const char b64url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static size_t b64url_encode(const uint8_t *in, size_t len, char *out) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t v = (uint32_t)in[i] << 16;
+        if (i + 1 < len) v |= (uint32_t)in[i + 1] << 8;
+        if (i + 2 < len) v |= in[i + 2];
+        for (size_t k = 0; k < 4 && k <= len - i; k++) out[n++] = b64url[(v >> (18 - 6 * k)) & 63];
+    }
+    out[n] = '\0';
+    return n;
+}
+
+// Decode up to cap bytes; returns the length, or -1 on bad characters
+static int b64url_decode(const char *in, uint8_t *out, size_t cap) {
+    uint32_t acc = 0;
+    int bits = 0, n = 0;
+    for (; *in; in++) {
+        const char *c = strchr(b64url, *in);
+        if (!c) return -1;
+        acc = (acc << 6) | (uint32_t)(c - b64url);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            if ((size_t)n == cap) return -1;
+            out[n++] = (uint8_t)(acc >> bits);
+        }
+    }
+    // Leftover bits must be zero, so every token has one spelling
+    return (bits >= 6 || (acc & ((1u << bits) - 1))) ? -1 : n;
+}
+
+static void challenge_mac(const uint8_t *key, size_t keylen, const uint8_t *body, size_t len,
+                          uint8_t mac[POW_CHALLENGE_MAC]) {
+    BLAKE2B_CTX ctx;
+    blake2b_init_key(&ctx, POW_CHALLENGE_MAC, key, keylen);
+    blake2b_update(&ctx, body, len);
+    blake2b_final(&ctx, mac, POW_CHALLENGE_MAC);
+}
+
+typedef struct {
+    HashAlgorithm algos[10];
+    int num_algos;
+    int difficulty;
+    int64_t expires;
+    size_t body_len;                // bytes covered by the MAC
+    uint8_t raw[POW_CHALLENGE_RAW_MAX];
+} ChallengeFields;
+
+// Decode a token's fields without checking its MAC; 0 if malformed
+static int challenge_decode(const char *challenge, ChallengeFields *f) {
+    int len = challenge ? b64url_decode(challenge, f->raw, sizeof(f->raw)) : -1;
+    if (len < 3 || f->raw[0] != POW_CHALLENGE_VERSION) return 0;
+
+    f->difficulty = f->raw[1];
+    f->num_algos = f->raw[2];
+    if (f->num_algos < 1 || f->num_algos > 10) return 0;
+    f->body_len = 3 + (size_t)f->num_algos + 8 + POW_CHALLENGE_SALT;
+    if ((size_t)len != f->body_len + POW_CHALLENGE_MAC) return 0;
+
+    for (int i = 0; i < f->num_algos; i++) {
+        f->algos[i] = (HashAlgorithm)f->raw[3 + i];
+        if (!hash_descriptor(f->algos[i])) return 0;
+    }
+    uint64_t expires = 0;
+    for (int i = 0; i < 8; i++) expires |= (uint64_t)f->raw[3 + f->num_algos + i] << (8 * i);
+    f->expires = (int64_t)expires;
+    return 1;
+}
+
+// Fill buf from the OS CSPRNG; 0 if it is unavailable
+static int os_random(uint8_t *buf, size_t len) {
+#if defined(_WIN32) || defined(_WIN64)
+    return BCryptGenRandom(NULL, buf, (ULONG)len, BCRYPT_USE_SYSTEM_PREFERRED_RNG) >= 0;
+#else
+#if defined(POW_HAVE_GETRANDOM)
+    size_t got = 0;
+    while (got < len) {
+        ssize_t r = getrandom(buf + got, len - got, 0);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) break;
+        got += (size_t)r;
+    }
+    if (got == len) return 1;
+#endif
+    // Older libcs, macOS, Android and Emscripten all provide /dev/urandom
+    FILE *f = fopen("/dev/urandom", "rb");
+    if (!f) return 0;
+    size_t n = fread(buf, 1, len, f);
+    fclose(f);
+    return n == len;
+#endif
+}
+
+// Salt for callers that pass none: OS randomness, or if that fails a MAC of
+// a per-process counter and the clock, unique per call and unpredictable
+// without the key
+static void challenge_salt(const uint8_t *key, size_t keylen, int64_t now, uint8_t salt[POW_CHALLENGE_SALT]) {
+    static atomic_ullong counter;
+    uint64_t seed[4];
+
+    if (os_random(salt, POW_CHALLENGE_SALT)) return;
+
+    seed[0] = atomic_fetch_add(&counter, 1);
+    seed[1] = (uint64_t)now;
+    seed[2] = (uint64_t)clock();
+    seed[3] = (uint64_t)(uintptr_t)&seed;
+    challenge_mac(key, keylen, (const uint8_t *)seed, sizeof(seed), salt);
+}
+
+// Issue a challenge that expires ttl seconds after now (<= 0: the current
+// time). salt is POW_CHALLENGE_SALT random bytes, or NULL to draw them from the OS.
+// Writes the NUL-terminated token to out and returns its size including
+// the NUL; nothing is written if cap is too small. 0 on invalid arguments.
+EXPORT size_t pow_challenge_issue(const uint8_t *key, size_t keylen, const HashAlgorithm *algos, int num_algos, int difficulty, int64_t ttl, const uint8_t *salt, int64_t now, char *out, size_t cap) {
+    uint8_t raw[POW_CHALLENGE_RAW_MAX];
+    size_t n = 0;
+
+    if (!key || keylen == 0 || keylen > BLAKE2B_KEYBYTES || !algos || num_algos < 1 || num_algos > 10) return 0;
+    if (difficulty < 0 || difficulty > 255 || ttl < 0) return 0;
     for (int i = 0; i < num_algos; i++) {
-        uint8_t hash[128];
-        int hash_size;
-        compute_hash(algos[i], (uint8_t*)combined, len + n, hash, &hash_size);
-        
-        if (!has_leading_zeros(hash, hash_size, difficulty)) {
-            return 0; // One failed, all must pass
+        if (!hash_descriptor(algos[i])) return 0;
+    }
+
+    now = replay_now(now);
+    uint64_t expires = ttl > INT64_MAX - now ? (uint64_t)INT64_MAX : (uint64_t)(now + ttl);
+    raw[n++] = POW_CHALLENGE_VERSION;
+    raw[n++] = (uint8_t)difficulty;
+    raw[n++] = (uint8_t)num_algos;
+    for (int i = 0; i < num_algos; i++) raw[n++] = (uint8_t)algos[i];
+    for (int i = 0; i < 8; i++) raw[n++] = (uint8_t)(expires >> (8 * i));
+    if (salt) memcpy(raw + n, salt, POW_CHALLENGE_SALT);
+    else challenge_salt(key, keylen, now, raw + n);
+    n += POW_CHALLENGE_SALT;
+    challenge_mac(key, keylen, raw, n, raw + n);
+    n += POW_CHALLENGE_MAC;
+
+    size_t need = (n * 4 + 2) / 3 + 1;
+    if (!out || cap < need) return need;
+    b64url_encode(raw, n, out);
+    return need;
+}
+
+// Read a token's algorithms (algos must hold 10), difficulty and expiry
+// without checking its MAC, e.g. to tell the client what to solve. Returns
+// 1 if the token is well formed, else 0.
+EXPORT int pow_challenge_parse(const char *challenge, HashAlgorithm *algos, int *num_algos, int *difficulty, int64_t *expires) {
+    ChallengeFields f;
+
+    if (!challenge_decode(challenge, &f)) return 0;
+    if (algos) memcpy(algos, f.algos, f.num_algos * sizeof(HashAlgorithm));
+    if (num_algos) *num_algos = f.num_algos;
+    if (difficulty) *difficulty = f.difficulty;
+    if (expires) *expires = f.expires;
+    return 1;
+}
+
+// Check that challenge was issued with key and has not expired at now (<= 0:
+// the current time), then verify the PoW under the token's own algorithms
+// and difficulty. With a replay store the solution is also consumed.
+// Returns one of the POW_VERIFY_* codes; only POW_VERIFY_OK means accept.
+EXPORT int pow_challenge_verify(const uint8_t *key, size_t keylen, const char *challenge, int64_t nonce, PowReplayStore *store, int64_t now) {
+    uint8_t mac[POW_CHALLENGE_MAC];
+    ChallengeFields f;
+
+    if (!key || keylen == 0 || keylen > BLAKE2B_KEYBYTES) return POW_VERIFY_ERROR;
+    if (!challenge_decode(challenge, &f)) return POW_VERIFY_BAD_CHALLENGE;
+
+    // Compare in constant time so the MAC cannot be guessed byte by byte
+    challenge_mac(key, keylen, f.raw, f.body_len, mac);
+    uint8_t diff = 0;
+    for (int i = 0; i < POW_CHALLENGE_MAC; i++) diff |= mac[i] ^ f.raw[f.body_len + i];
+    if (diff) return POW_VERIFY_BAD_CHALLENGE;
+
+    if (replay_now(now) > f.expires) return POW_VERIFY_EXPIRED;
+    size_t len = strlen(challenge);
+    if (!verify_pow_multi_buf((const uint8_t *)challenge, len, nonce, f.algos, f.num_algos, f.difficulty)) {
+        return POW_VERIFY_INVALID;
+    }
+    return store ? replay_insert(store, replay_key((const uint8_t *)challenge, len, nonce), now) : POW_VERIFY_OK;
+}
+
+/*
+ * Adaptive difficulty
+ *
+ * A PowController picks each challenge's difficulty and algorithms so that
+ * a client solves it in about target_seconds while verification stays
+ * within verify_budget (CPU seconds per second). Per bucket (a client, IP
+ * range, ...) it keeps an EWMA of the client's speed in log2 hashes per
+ * second, estimated from observed solve times, and a decaying rate of
+ * challenge requests:
+ *
+ *   work bits = log2(speed * target)        expected solve time on target
+ *             + log2(rate * target) if > 0  more requests than one client
+ *                                           solving in turn can make
+ *             + log2(load / budget) if > 0  server over its verify budget
+ *
+ * Every algorithm of a challenge must pass, so k algorithms at difficulty d
+ * take 2^(k*d) attempts. The controller uses as many of the configured
+ * algorithms as the verify budget allows at the current request rate and
+ * spreads the work bits over them. Spammy buckets get harder challenges
+ * while quiet clients keep the target latency.
+ */
+
+#define CTRL_ALPHA          0.25    // EWMA weight of a new solve-time sample
+#define CTRL_RATE_WINDOW    10.0    // seconds for request rates to decay by half
+#define CTRL_PROBE          8       // slots searched per bucket lookup
+#define CTRL_EULER_BITS     0.8327  // E[log2 t] of an exponential solve time is log2(mean) - gamma/ln 2
+
+typedef struct {
+    uint64_t id;
+    int used;
+    double speed;                   // log2 attempts per second (EWMA)
+    double rate;                    // decayed request count, see ctrl_decay
+    double last;                    // time of the last update
+} CtrlBucket;
+
+typedef struct PowController {
+    HashAlgorithm algos[10];
+    int num_algos;
+    double verify_cost[10];         // CPU seconds to verify with the first i+1 algorithms
+    double target;                  // seconds
+    double budget;                  // CPU seconds of verification per second
+    int min_difficulty, max_difficulty;
+    double prior_speed;             // EWMA over all buckets, for new ones
+    double rate, last;              // all requests
+    CtrlBucket *buckets;
+    size_t mask;
+    pow_mutex_t lock;
+} PowController;
+
+// log2 and 2^y without libm, which the libraries do not link; accurate to
+// about 1e-6, far below what difficulty rounding needs
+static double ctrl_log2(double x) {
+    int e = 0;
+    if (x <= 0) return -1074;
+    while (x >= 2) { x *= 0.5; e++; }
+    while (x < 1) { x *= 2; e--; }
+    double t = (x - 1) / (x + 1), t2 = t * t;
+    double ln = 2 * t * (1 + t2 * (1.0 / 3 + t2 * (1.0 / 5 + t2 * (1.0 / 7 + t2 / 9))));
+    return e + ln * 1.4426950408889634;
+}
+
+static double ctrl_exp2(double y) {
+    double scale = 1;
+    if (y > 60) y = 60;
+    if (y < -60) return 0;
+    while (y < 0) { y += 1; scale *= 0.5; }
+    while (y >= 1) { y -= 1; scale *= 2; }
+    double x = y * 0.6931471805599453, term = 1, sum = 1;
+    for (int i = 1; i < 10; i++) {
+        term *= x / i;
+        sum += term;
+    }
+    return scale * sum;
+}
+
+static double ctrl_now(double now) {
+    return now > 0 ? now : (double)time(NULL);
+}
+
+// Requests per second from a count that halves every CTRL_RATE_WINDOW
+static double ctrl_decay(double *count, double *last, double now) {
+    if (now > *last) {
+        *count *= ctrl_exp2(-(now - *last) / CTRL_RATE_WINDOW);
+        *last = now;
+    }
+    return *count * 0.6931471805599453 / CTRL_RATE_WINDOW;
+}
+
+// Seconds per verification of a short challenge with algo, on the
+// monotonic clock: clock() counts CPU time of the whole process, which
+// other busy threads inflate and coarse platforms round to 10 ms.
+static double ctrl_measure(HashAlgorithm algo) {
+    uint8_t msg[64] = {0}, digest[HASH_MAX_DIGEST];
+    long runs = 0;
+    unsigned long long start = pow_clock_ns(), elapsed;
+
+    do {
+        for (int i = 0; i < 64; i++, runs++) {
+            msg[0] = (uint8_t)runs;
+            hash_compute(algo, msg, sizeof(msg), digest);
         }
+        elapsed = pow_clock_ns() - start;
+    } while (elapsed < 5000000ULL);
+    return (double)elapsed * 1e-9 / (double)runs;
+}
+
+// Bucket for id, taking over the least recently used slot of its probe
+// window when id is new. Called with the lock held.
+static CtrlBucket *ctrl_bucket(PowController *c, uint64_t id, double now) {
+    uint64_t h = id * 0x9E3779B97F4A7C15ull;
+    CtrlBucket *victim = NULL;
+
+    for (int i = 0; i < CTRL_PROBE; i++) {
+        CtrlBucket *b = &c->buckets[(size_t)(h + (uint64_t)i) & c->mask];
+        if (b->used && b->id == id) return b;
+        if (!victim || (victim->used && (!b->used || b->last < victim->last))) victim = b;
     }
-    
-    return 1; // All passed
+    victim->id = id;
+    victim->used = 1;
+    victim->speed = c->prior_speed;
+    victim->rate = 0;
+    victim->last = now;
+    return victim;
+}
+
+// Create a controller issuing challenges over algos (1-10, in the order
+// they are added) that take target_seconds to solve, keeping verification
+// under verify_budget CPU seconds per second, with difficulty in
+// [min_difficulty, max_difficulty]. New clients start at base_difficulty
+// bits of work. Tracks up to `buckets` clients (rounded up to a
+// power of two). NULL on invalid arguments.
+EXPORT PowController *pow_controller_create(const HashAlgorithm *algos, int num_algos, double target_seconds, double verify_budget, int min_difficulty, int max_difficulty, int base_difficulty, size_t buckets) {
+    size_t slots = CTRL_PROBE;
+
+    if (!algos || num_algos < 1 || num_algos > 10 || !(target_seconds > 0) || !(verify_budget > 0)) return NULL;
+    if (min_difficulty < 0 || max_difficulty < min_difficulty || max_difficulty > 255) return NULL;
+    for (int i = 0; i < num_algos; i++) {
+        if (!hash_descriptor(algos[i])) return NULL;
+    }
+    while (slots < buckets && slots < ((size_t)1 << 30)) slots *= 2;
+
+    PowController *c = (PowController *)calloc(1, sizeof(PowController));
+    if (!c) return NULL;
+    c->buckets = (CtrlBucket *)calloc(slots, sizeof(CtrlBucket));
+    if (!c->buckets) {
+        free(c);
+        return NULL;
+    }
+    c->mask = slots - 1;
+    memcpy(c->algos, algos, num_algos * sizeof(HashAlgorithm));
+    c->num_algos = num_algos;
+    for (int i = 0; i < num_algos; i++) {
+        c->verify_cost[i] = (i ? c->verify_cost[i - 1] : 0) + ctrl_measure(algos[i]);
+    }
+    c->target = target_seconds;
+    c->budget = verify_budget;
+    c->min_difficulty = min_difficulty;
+    c->max_difficulty = max_difficulty;
+    c->prior_speed = base_difficulty - ctrl_log2(target_seconds);
+    pow_mutex_init(&c->lock);
+    return c;
+}
+
+EXPORT void pow_controller_free(PowController *c) {
+    if (!c) return;
+    pow_mutex_destroy(&c->lock);
+    free(c->buckets);
+    free(c);
+}
+
+// Record that the client in `bucket` solved a challenge of num_algos
+// algorithms at `difficulty` in solve_seconds (issue to submission).
+// now <= 0 means the current time.
+EXPORT void pow_controller_observe(PowController *c, uint64_t bucket, int difficulty, int num_algos, double solve_seconds, double now) {
+    if (!c || num_algos < 1) return;
+    if (solve_seconds < 0.001) solve_seconds = 0.001;
+    now = ctrl_now(now);
+
+    double sample = (double)difficulty * num_algos - ctrl_log2(solve_seconds) - CTRL_EULER_BITS;
+    pow_mutex_lock(&c->lock);
+    CtrlBucket *b = ctrl_bucket(c, bucket, now);
+    b->speed += CTRL_ALPHA * (sample - b->speed);
+    c->prior_speed += CTRL_ALPHA / 16 * (sample - c->prior_speed);
+    pow_mutex_unlock(&c->lock);
+}
+
+// Difficulty and algorithms (algos must hold 10) for the next challenge
+// issued to `bucket`; counts as a request. now <= 0 means the current time.
+// Returns the difficulty, -1 on invalid arguments.
+EXPORT int pow_controller_next(PowController *c, uint64_t bucket, HashAlgorithm *algos, int *num_algos, double now) {
+    if (!c || !algos || !num_algos) return -1;
+    now = ctrl_now(now);
+
+    pow_mutex_lock(&c->lock);
+    CtrlBucket *b = ctrl_bucket(c, bucket, now);
+    ctrl_decay(&b->rate, &b->last, now);
+    b->rate += 1;
+    double rate = ctrl_decay(&b->rate, &b->last, now);
+    ctrl_decay(&c->rate, &c->last, now);
+    c->rate += 1;
+    double load = ctrl_decay(&c->rate, &c->last, now);
+    double bits = b->speed + ctrl_log2(c->target);
+    pow_mutex_unlock(&c->lock);
+
+    // Bucket rate beyond one client solving back to back
+    if (rate * c->target > 1) bits += ctrl_log2(rate * c->target);
+
+    // As many algorithms as the budget affords; past that, harder work
+    int k = c->num_algos;
+    while (k > 1 && load * c->verify_cost[k - 1] > c->budget) k--;
+    if (load * c->verify_cost[k - 1] > c->budget) bits += ctrl_log2(load * c->verify_cost[k - 1] / c->budget);
+
+    double d = bits / k + 0.5;
+    int difficulty = d < c->min_difficulty ? c->min_difficulty : d > c->max_difficulty ? c->max_difficulty : (int)d;
+    memcpy(algos, c->algos, k * sizeof(HashAlgorithm));
+    *num_algos = k;
+    return difficulty;
 }
 
 // Get hash algorithm by name
 EXPORT int get_hash_algo_by_name(const char *name) {
-    if (strcmp(name, "MD4") == 0) return HASH_MD4;
-    if (strcmp(name, "NT") == 0) return HASH_NT;
-    if (strcmp(name, "MD5") == 0) return HASH_MD5;
-    if (strcmp(name, "HAS-160") == 0) return HASH_HAS160;
-    if (strcmp(name, "RIPEMD-256") == 0) return HASH_RIPEMD256;
-    if (strcmp(name, "RIPEMD-128") == 0) return HASH_RIPEMD128;
-    if (strcmp(name, "BLAKE2s-128") == 0) return HASH_BLAKE2S_128;
-    if (strcmp(name, "BLAKE2s-160") == 0) return HASH_BLAKE2S_160;
-    if (strcmp(name, "BLAKE2s-256") == 0) return HASH_BLAKE2S_256;
-    if (strcmp(name, "BLAKE2b-512") == 0) return HASH_BLAKE2B_512;
-    if (strcmp(name, "RIPEMD-320") == 0) return HASH_RIPEMD320;
-    if (strcmp(name, "BLAKE2b-128") == 0) return HASH_BLAKE2B_128;
-    if (strcmp(name, "BLAKE2b-384") == 0) return HASH_BLAKE2B_384;
-    if (strcmp(name, "RIPEMD-160") == 0) return HASH_RIPEMD160;
-    if (strcmp(name, "BLAKE2b-160") == 0) return HASH_BLAKE2B_160;
-    if (strcmp(name, "BLAKE2b-256") == 0) return HASH_BLAKE2B_256;
-    if (strcmp(name, "SHA2-256") == 0 || strcmp(name, "SHA256") == 0) return HASH_SHA256;
-    if (strcmp(name, "SHA-0") == 0) return HASH_SHA0;
-    if (strcmp(name, "SHA-1") == 0 || strcmp(name, "SHA1") == 0) return HASH_SHA1;
-    if (strcmp(name, "SHA2-224") == 0) return HASH_SHA224;
-    if (strcmp(name, "SHA2-512") == 0) return HASH_SHA512;
-    if (strcmp(name, "SHA2-384") == 0) return HASH_SHA384;
-    if (strcmp(name, "Whirlpool") == 0) return HASH_WHIRLPOOL;
-    if (strcmp(name, "SHA3-224") == 0) return HASH_SHA3_224;
-    if (strcmp(name, "SHAKE-256") == 0) return HASH_SHAKE256;
-    if (strcmp(name, "SHA3-384") == 0) return HASH_SHA3_384;
-    if (strcmp(name, "SHAKE-128") == 0) return HASH_SHAKE128;
-    if (strcmp(name, "Keccak-384") == 0) return HASH_KECCAK384;
-    if (strcmp(name, "Keccak-256") == 0) return HASH_KECCAK256;
-    if (strcmp(name, "SHA3-256") == 0) return HASH_SHA3_256;
-    if (strcmp(name, "SHA3-512") == 0) return HASH_SHA3_512;
-    if (strcmp(name, "Keccak-512") == 0) return HASH_KECCAK512;
-    if (strcmp(name, "Keccak-224") == 0) return HASH_KECCAK224;
-    if (strcmp(name, "MD2") == 0) return HASH_MD2;
-    return -1;
+    return hash_algo_by_name(name);
+}
+
+// Runtime CPU dispatch: features in use (see crypto/cpu/cpu_features.h)
+EXPORT uint32_t pow_cpu_features(void) {
+    return cpu_features();
+}
+
+// Restrict the CPU features kernels may use and reselect backends; pass
+// 0xFFFFFFFF to undo, 0 for the portable code. Not while a search runs.
+EXPORT uint32_t pow_force_cpu_features(uint32_t mask) {
+    return hash_registry_force(mask);
+}
+
+// Name of the implementation selected for algo ("scalar", "sha-ni", ...)
+EXPORT const char *pow_hash_backend(HashAlgorithm algo) {
+    const HashDescriptor *d = hash_descriptor(algo);
+    return d ? d->backend : NULL;
 }
@@ -0,0 +1,128 @@
+#ifndef TARGET_H
+#define TARGET_H
+
+/*
+ * Difficulty checks on digests. The usual one is a count of leading zero
+ * bits, tested once per candidate nonce.
+ *
+ * Target-based difficulty. A target is a 256-bit big-endian number and a
+ * digest passes if, read as a big-endian fraction (padded with zero bytes
+ * when shorter than 32 bytes), it is <= target. Unlike a leading-zero bit
+ * count the expected work can be any value >= 1, not only powers of two:
+ * pow_target_from_work(2^d) is the same test as d leading zero bits.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define POW_TARGET_BYTES 32
+
+static inline uint64_t pow_load_be64(const uint8_t *p) {
+    return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+           ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) | ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+}
+
+// 1 if hash starts with at least `difficulty` zero bits. Words wholly
+// inside the difficulty only have to be zero; the bit count is needed for
+// the boundary word alone.
+static inline int pow_has_leading_zeros(const uint8_t *hash, int hash_size, int difficulty) {
+    if (difficulty <= 0) return 1;
+    if (difficulty > hash_size * 8) return 0;
+
+    int whole = difficulty / 64, rest = difficulty % 64;
+    uint64_t acc = 0;
+    for (int i = 0; i < whole; i++) {
+        uint64_t w;
+        memcpy(&w, hash + 8 * i, 8);
+        acc |= w;
+    }
+    if (acc) return 0;
+    if (!rest) return 1;
+
+    // The boundary word may run past a short digest; its bytes beyond the
+    // digest are never among the first `rest` bits
+    const uint8_t *p = hash + 8 * whole;
+    uint64_t w;
+    if (hash_size - 8 * whole >= 8) {
+        w = pow_load_be64(p);
+    } else {
+        uint8_t tail[8] = {0};
+        memcpy(tail, p, (size_t)(hash_size - 8 * whole));
+        w = pow_load_be64(tail);
+    }
+    return __builtin_clzll(w | 1) >= rest;    // | 1: rest <= 63, and clz(0) is undefined
+}
+
+// 1 if hash <= target, comparing eight bytes at a time
+static inline int pow_meets_target(const uint8_t *hash, int hash_size, const uint8_t target[POW_TARGET_BYTES]) {
+    int n = hash_size < POW_TARGET_BYTES ? hash_size : POW_TARGET_BYTES;
+
+    for (int i = 0; i < n; i += 8) {
+        uint64_t h, t = pow_load_be64(target + i);
+        if (n - i >= 8) {
+            h = pow_load_be64(hash + i);
+        } else {
+            // Short digests (20, 28 bytes) end in a partial word; the zero
+            // padding is <= any target bytes it meets
+            uint8_t tail[8] = {0};
+            memcpy(tail, hash + i, (size_t)(n - i));
+            h = pow_load_be64(tail);
+        }
+        if (h != t) return h < t;
+    }
+    return 1;
+}
+
+// Leading zero bits of the target; every passing digest has at least as
+// many, which makes this the difficulty for leading-zero prefilters
+static inline int pow_target_zero_bits(const uint8_t target[POW_TARGET_BYTES]) {
+    int bits = 0;
+    for (int i = 0; i < POW_TARGET_BYTES; i++) {
+        uint8_t b = target[i];
+        if (!b) {
+            bits += 8;
+            continue;
+        }
+        while (!(b & 0x80)) {
+            b <<= 1;
+            bits++;
+        }
+        break;
+    }
+    return bits;
+}
+
+/*
+ * Target that a uniformly random digest meets with probability 1 / work:
+ * ceil(2^256 / work) - 1. 1/work is expanded byte by byte, which is exact
+ * for the double it is. Returns 0 (target untouched) if work < 1 or NaN.
+ */
+static inline int pow_target_from_work(double work, uint8_t target[POW_TARGET_BYTES]) {
+    if (!(work >= 1)) return 0;
+    if (work == 1) {
+        memset(target, 0xFF, POW_TARGET_BYTES);
+        return 1;
+    }
+
+    double x = 1 / work;
+    if (x == 0) {
+        memset(target, 0, POW_TARGET_BYTES);    // beyond 2^1074: only an all-zero digest
+        return 1;
+    }
+    for (int i = 0; i < POW_TARGET_BYTES; i++) {
+        x *= 256;
+        int b = (int)x;
+        target[i] = (uint8_t)b;
+        x -= b;
+    }
+
+    // ceil(...) - 1: subtract one unless bits were left below the last byte
+    if (x == 0) {
+        int i = POW_TARGET_BYTES - 1;
+        while (i >= 0 && target[i] == 0) target[i--] = 0xFF;
+        if (i >= 0) target[i]--;
+    }
+    return 1;
+}
+
+#endif /* TARGET_H */
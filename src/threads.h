@@ -0,0 +1,161 @@
+#ifndef THREADS_H
+#define THREADS_H
+
+/*
+ * Minimal portable threading shim used by the client and server libraries.
+ * Win32 threads on Windows, pthreads everywhere else. Builds without thread
+ * support (plain Emscripten) get POW_HAVE_THREADS == 0 and callers run their
+ * work inline on the calling thread.
+ */
+
+#include <stddef.h>
+#include <time.h>
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #define POW_HAVE_THREADS 0
+#elif defined(_WIN32) || defined(_WIN64)
+    #define POW_HAVE_THREADS 1
+    #define POW_WIN32_THREADS 1
+    #include <windows.h>
+#else
+    #define POW_HAVE_THREADS 1
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+#endif
+
+#define POW_MAX_THREADS 256
+
+// Monotonic clock in nanoseconds, for short in-process measurements
+#if defined(POW_WIN32_THREADS)
+static inline unsigned long long pow_clock_ns(void) {
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (unsigned long long)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+}
+#else
+static inline unsigned long long pow_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+#endif
+
+typedef void (*pow_thread_fn)(void *arg);
+
+#if defined(POW_WIN32_THREADS)
+typedef CRITICAL_SECTION pow_mutex_t;
+static inline void pow_mutex_init(pow_mutex_t *m)    { InitializeCriticalSection(m); }
+static inline void pow_mutex_destroy(pow_mutex_t *m) { DeleteCriticalSection(m); }
+static inline void pow_mutex_lock(pow_mutex_t *m)    { EnterCriticalSection(m); }
+static inline void pow_mutex_unlock(pow_mutex_t *m)  { LeaveCriticalSection(m); }
+#elif POW_HAVE_THREADS
+typedef pthread_mutex_t pow_mutex_t;
+static inline void pow_mutex_init(pow_mutex_t *m)    { pthread_mutex_init(m, NULL); }
+static inline void pow_mutex_destroy(pow_mutex_t *m) { pthread_mutex_destroy(m); }
+static inline void pow_mutex_lock(pow_mutex_t *m)    { pthread_mutex_lock(m); }
+static inline void pow_mutex_unlock(pow_mutex_t *m)  { pthread_mutex_unlock(m); }
+#else
+typedef int pow_mutex_t;
+static inline void pow_mutex_init(pow_mutex_t *m)    { (void)m; }
+static inline void pow_mutex_destroy(pow_mutex_t *m) { (void)m; }
+static inline void pow_mutex_lock(pow_mutex_t *m)    { (void)m; }
+static inline void pow_mutex_unlock(pow_mutex_t *m)  { (void)m; }
+#endif
+
+// Give up the rest of the time slice (spin-wait back-off)
+static inline void pow_thread_yield(void) {
+#if defined(POW_WIN32_THREADS)
+    SwitchToThread();
+#elif POW_HAVE_THREADS
+    sched_yield();
+#endif
+}
+
+// Number of online CPUs (at least 1)
+static inline int pow_cpu_count(void) {
+#if defined(POW_WIN32_THREADS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#elif POW_HAVE_THREADS && defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+// Resolve a caller-supplied thread count (<= 0 means one per CPU)
+static inline int pow_resolve_threads(int threads) {
+    if (!POW_HAVE_THREADS) return 1;
+    if (threads <= 0) threads = pow_cpu_count();
+    if (threads > POW_MAX_THREADS) threads = POW_MAX_THREADS;
+    return threads;
+}
+
+#if defined(POW_WIN32_THREADS)
+typedef struct { pow_thread_fn fn; void *arg; } pow_thread_start_t;
+
+static inline DWORD WINAPI pow_thread_trampoline(LPVOID p) {
+    pow_thread_start_t *s = (pow_thread_start_t *)p;
+    s->fn(s->arg);
+    return 0;
+}
+#elif POW_HAVE_THREADS
+typedef struct { pow_thread_fn fn; void *arg; } pow_thread_start_t;
+
+static inline void *pow_thread_trampoline(void *p) {
+    pow_thread_start_t *s = (pow_thread_start_t *)p;
+    s->fn(s->arg);
+    return NULL;
+}
+#endif
+
+/*
+ * Run fn(args[i]) for i in [0, count) on `count` threads and wait for all of
+ * them. The calling thread runs args[0] itself; if a thread cannot be
+ * started its work item is run inline, so every item always runs exactly once.
+ */
+static inline void pow_run_parallel(pow_thread_fn fn, void *args, size_t arg_size, int count) {
+    char *base = (char *)args;
+#if POW_HAVE_THREADS
+    pow_thread_start_t starts[POW_MAX_THREADS];
+#if defined(POW_WIN32_THREADS)
+    HANDLE handles[POW_MAX_THREADS];
+#else
+    pthread_t handles[POW_MAX_THREADS];
+#endif
+    int started[POW_MAX_THREADS];
+
+    if (count > POW_MAX_THREADS) count = POW_MAX_THREADS;
+    for (int i = 1; i < count; i++) {
+        starts[i].fn = fn;
+        starts[i].arg = base + (size_t)i * arg_size;
+#if defined(POW_WIN32_THREADS)
+        handles[i] = CreateThread(NULL, 0, pow_thread_trampoline, &starts[i], 0, NULL);
+        started[i] = handles[i] != NULL;
+#else
+        started[i] = pthread_create(&handles[i], NULL, pow_thread_trampoline, &starts[i]) == 0;
+#endif
+    }
+    if (count > 0) fn(base);
+    for (int i = 1; i < count; i++) {
+        if (!started[i]) {
+            fn(base + (size_t)i * arg_size);
+            continue;
+        }
+#if defined(POW_WIN32_THREADS)
+        WaitForSingleObject(handles[i], INFINITE);
+        CloseHandle(handles[i]);
+#else
+        pthread_join(handles[i], NULL);
+#endif
+    }
+#else
+    for (int i = 0; i < count; i++) fn(base + (size_t)i * arg_size);
+#endif
+}
+
+#endif /* THREADS_H */